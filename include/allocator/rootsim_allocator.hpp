@@ -1,6 +1,7 @@
 #pragma once
 
 #include <core/core.hpp>
+#include <cstdlib>
 #include <engine.hpp>
 #include <utility>
 
@@ -12,6 +13,12 @@
 /// template takes a type parameter `T`, which represents the element type to be
 /// allocated.
 ///
+/// When the native engine is progressing the simulation, there is no ROOT-Sim
+/// memory manager available. In that case, the allocation requests are served
+/// by the C allocator. The ROOT-Sim does not zero-initialize the allocated
+/// memory, therefore, the services must not assume that it is zeroed, even
+/// though the native engine's allocations happen to be.
+///
 /// \tparam T The element type to be allocated.
 template <typename T = std::nullptr_t>
 class ROOTSimAllocator
@@ -47,7 +54,7 @@ public:
     ENGINE_INLINE
     pointer allocate(size_type n)
     {
-        return static_cast<pointer>(rs_malloc(sizeof(value_type) * n));
+        return static_cast<pointer>(doAllocate(sizeof(value_type) * n));
     }
 
     /// \brief Deallocate memory.
@@ -56,7 +63,7 @@ public:
     ENGINE_INLINE
     void deallocate(pointer p, size_type n)
     {
-        rs_free(p);
+        doDeallocate(p);
     }
 
     /// \brief Allocate memory.
@@ -66,7 +73,7 @@ public:
     template <typename U>
     ENGINE_INLINE static U *allocate(std::size_t n)
     {
-        return static_cast<U *>(rs_malloc(sizeof(U) * n));
+        return static_cast<U *>(doAllocate(sizeof(U) * n));
     }
 
     /// \brief Deallocate memory.
@@ -75,7 +82,7 @@ public:
     template <typename U>
     ENGINE_INLINE static void deallocate(U *ptr)
     {
-        rs_free(ptr);
+        doDeallocate(ptr);
     }
 
     /// \brief Allocate memory and construct in-place.
@@ -86,6 +93,29 @@ public:
     template <typename U, typename... Args>
     ENGINE_INLINE static U *construct(Args &&...args)
     {
-        return new (rs_malloc(sizeof(U))) U(std::forward<Args>(args)...);
+        return new (doAllocate(sizeof(U))) U(std::forward<Args>(args)...);
+    }
+
+private:
+    /// \brief Allocate memory from the engine that is progressing the
+    ///        simulation.
+    /// \param size The amount of bytes to allocate.
+    /// \return A pointer to the allocated space.
+    ENGINE_INLINE static void *doAllocate(const std::size_t size)
+    {
+        if (ispd::native::g_Active)
+            return std::calloc(1, size);
+        return rs_malloc(size);
+    }
+
+    /// \brief Deallocate memory from the engine that is progressing the
+    ///        simulation.
+    /// \param ptr Pointer to the memory to deallocate.
+    ENGINE_INLINE static void doDeallocate(void *ptr)
+    {
+        if (ispd::native::g_Active)
+            std::free(ptr);
+        else
+            rs_free(ptr);
     }
 };
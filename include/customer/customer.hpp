@@ -34,7 +34,7 @@ class Customer
 /// manage the completion status of tasks within a system or application. By
 /// using this enum, developers can easily determine the current state of a task
 /// and take appropriate actions based on its completion status.
-enum class TaskCompletionState
+enum class TaskCompletionState : uint8_t
 {
     JUST_GENERATED,
     PROCESSED
@@ -73,8 +73,9 @@ public:
                   const sid_t    origin,
                   const double   processingSize,
                   const double   communicationSize) noexcept
-        : m_Tid(tid), m_Origin(origin), m_ProcSize(processingSize),
+        : m_Tid(tid), m_ProcSize(processingSize),
           m_CommSize(communicationSize),
+          m_Origin(static_cast<uint32_t>(origin)),
           m_CompletionState(TaskCompletionState::JUST_GENERATED)
     {}
 
@@ -92,8 +93,10 @@ public:
                   const double              processingSize,
                   const double              communicationSize,
                   const TaskCompletionState completionState) noexcept
-        : m_Tid(tid), m_Origin(origin), m_ProcSize(processingSize),
-          m_CommSize(communicationSize), m_CompletionState(completionState)
+        : m_Tid(tid), m_ProcSize(processingSize),
+          m_CommSize(communicationSize),
+          m_Origin(static_cast<uint32_t>(origin)),
+          m_CompletionState(completionState)
     {}
 
     /// \brief Returns the processing size of the task in megaflops.
@@ -137,6 +140,24 @@ public:
         return m_CompletionState;
     }
 
+    /// \brief Returns the index of the machine that processes the task,
+    ///        within the cluster that is the task's destination.
+    ///
+    /// \return The machine's index within the destination cluster.
+    ENGINE_INLINE uint16_t getMember() const
+    {
+        return m_Member;
+    }
+
+    /// \brief Sets the index of the machine that processes the task, within
+    ///        the cluster that is the task's destination.
+    ///
+    /// \param member The machine's index within the destination cluster.
+    ENGINE_INLINE void setMember(const uint16_t member)
+    {
+        m_Member = member;
+    }
+
 private:
     /// \brief Task identifier.
     ///
@@ -165,36 +186,6 @@ private:
     ///
     uint64_t m_Tid;
 
-    /// \brief Represents the identifier of the master that originated the task.
-    ///
-    /// The `m_Origin` member variable stores the identifier of the master
-    /// that initially scheduled or created the task. It serves as a reference
-    /// to identify the original source of the task within the simulation.
-    ///
-    /// In a distributed simulation environment, a task can be scheduled and
-    /// processed by multiple masters as it traverses the simulation network.
-    /// However, the `m_Origin` identifier points to the master that first
-    /// scheduled the task.
-    ///
-    /// This information is valuable because it allows intermediate masters
-    /// along the route to determine whether the task should be forwarded to the
-    /// next master or processed locally as if it were their own task. By
-    /// inspecting the `m_Origin` identifier, masters can make informed
-    /// decisions about task handling based on its origin.
-    ///
-    /// It is important to note that the `m_Origin` identifier remains
-    /// constant throughout the task's journey from the source to its final
-    /// destination. Even if multiple masters participate in scheduling and
-    /// forwarding the task, this identifier refers to the original master that
-    /// initiated the task.
-    ///
-    /// \note While the `m_Origin` identifier provides valuable context about
-    /// the task's origin, it does not necessarily indicate the current master
-    /// processing or handling the task. Use other relevant member variables or
-    /// functions to obtain information about the current master.
-    ///
-    sid_t m_Origin;
-
     /// \brief Task Processing Size (in megaflops).
     ///
     /// The task processing size represents the computational resource required
@@ -255,6 +246,39 @@ private:
     ///
     double m_CommSize;
 
+    /// \brief Represents the identifier of the master that originated the task.
+    ///
+    /// The `m_Origin` member variable stores the identifier of the master
+    /// that initially scheduled or created the task. It serves as a reference
+    /// to identify the original source of the task within the simulation.
+    ///
+    /// In a distributed simulation environment, a task can be scheduled and
+    /// processed by multiple masters as it traverses the simulation network.
+    /// However, the `m_Origin` identifier points to the master that first
+    /// scheduled the task.
+    ///
+    /// This information is valuable because it allows intermediate masters
+    /// along the route to determine whether the task should be forwarded to the
+    /// next master or processed locally as if it were their own task. By
+    /// inspecting the `m_Origin` identifier, masters can make informed
+    /// decisions about task handling based on its origin.
+    ///
+    /// It is important to note that the `m_Origin` identifier remains
+    /// constant throughout the task's journey from the source to its final
+    /// destination. Even if multiple masters participate in scheduling and
+    /// forwarding the task, this identifier refers to the original master that
+    /// initiated the task.
+    ///
+    /// \note While the `m_Origin` identifier provides valuable context about
+    /// the task's origin, it does not necessarily indicate the current master
+    /// processing or handling the task. Use other relevant member variables or
+    /// functions to obtain information about the current master.
+    ///
+    /// \note The identifier is stored in 32 bits to keep the events compact,
+    ///       since the services' identifiers are limited to 32 bits.
+    ///
+    uint32_t m_Origin;
+
     /// \brief Represents the completion state of a task.
     ///
     /// The TaskCompletionState enumeration is used to indicate the state of
@@ -275,6 +299,17 @@ private:
     ///                This state indicates that the task has undergone some
     ///                form of processing, computation, or execution.
     TaskCompletionState m_CompletionState;
+
+    /// \brief The index of the machine that processes the task, within the
+    ///        cluster that is the task's destination.
+    ///
+    /// A cluster represents many identical machines in a single service (see
+    /// `Cluster`). Therefore, the task must carry which of them has been
+    /// scheduled. The index is zero if the destination is not a cluster.
+    ///
+    /// \note The index is stored in the padding that follows the completion
+    ///       state, therefore, it does not increase the events' size.
+    uint16_t m_Member = 0U;
 };
 
 #endif // ENGINE_CUSTOMER_HPP
@@ -2,9 +2,16 @@
 #define ENGINE_HPP
 
 #include <core/core.hpp>
+#include <cstddef>
+#include <type_traits>
 
 #define TASK_ARRIVAL        1
 #define TASK_SCHEDULER_INIT 2
+#define TASK_DEPARTURE      3
+
+/// \brief The maximum size (in bytes) of the data that an event handler may
+///        save to be used by its reverse event handler.
+#define ENGINE_MAX_REVERSE_DATA_SIZE 64
 
 /**
  * Simulator
@@ -27,6 +34,69 @@ extern "C"
 
 namespace ispd
 {
+/// \struct ScheduledEvent
+///
+/// \brief An event to be scheduled as part of a batch (see
+///        \c ispd::schedule_events).
+///
+/// The event content is not owned by the descriptor, therefore, it must
+/// remain valid until the batch has been scheduled.
+struct ScheduledEvent
+{
+    sid_t       m_Receiver;
+    timestamp_t m_Time;
+    unsigned    m_Type;
+    const void *m_Content;
+    std::size_t m_Size;
+};
+
+namespace native
+{
+/// \brief Indicates whether the native engine is the one currently progressing
+///        the simulation.
+///
+/// This flag is set by the native simulator before any service is initialized
+/// and it is cleared after all services have been finalized. While it is set,
+/// the engine functions below are served by the native engine instead of the
+/// underlying simulator selected at compile time.
+extern bool g_Active;
+
+/// \brief Schedule an event in the native engine's pending event set.
+void schedule_event(const sid_t       id,
+                    const timestamp_t time,
+                    const unsigned    eventType,
+                    const void       *event,
+                    const std::size_t eventSize);
+
+/// \brief Schedule a batch of events in the native engine's pending event
+///        set.
+void schedule_events(const ScheduledEvent *events, const std::size_t count);
+
+/// \brief Returns a pseudo-random number uniformly distributed in [0, 1)
+///        drawn from the stream of the service being currently processed.
+double random();
+
+/// \brief Returns the reverse data storage of the event being currently
+///        processed (or reversed).
+void *reverse_data();
+} // namespace native
+
+#ifdef ROOTSIM_ENGINE
+namespace rootsim
+{
+/// \brief Schedule an event in the ROOT-Sim.
+///
+/// The ROOT-Sim breaks the ties between the events with the same timestamp by
+/// their sizes and it aborts if an event is scheduled before the one being
+/// currently processed. Therefore, an event with the same timestamp of the
+/// current event, but smaller than it, is padded to the current event's size.
+void schedule_event(const sid_t       id,
+                    const timestamp_t time,
+                    const unsigned    eventType,
+                    const void       *event,
+                    const std::size_t eventSize);
+} // namespace rootsim
+#endif // ROOT-Sim
 
 ENGINE_INLINE void schedule_event(const sid_t       id,
                                   const timestamp_t time,
@@ -34,10 +104,86 @@ ENGINE_INLINE void schedule_event(const sid_t       id,
                                   const void       *event,
                                   const std::size_t eventSize)
 {
+    if (native::g_Active) {
+        native::schedule_event(id, time, eventType, event, eventSize);
+        return;
+    }
+
 #ifdef ROOTSIM_ENGINE
-    ScheduleNewEvent(id, time, eventType, event, eventSize);
+    rootsim::schedule_event(id, time, eventType, event, eventSize);
 #endif // ROOT-Sim
 }
+
+/// \brief Schedule a contiguous batch of events.
+///
+/// The events are scheduled in the order in which they appear in the batch,
+/// therefore, it is equivalent to calling \c ispd::schedule_event for each
+/// event. However, the native engine inserts the whole batch in its pending
+/// event set at once, instead of performing one insertion per event, which
+/// is cheaper when a large amount of events is injected, such as the initial
+/// tasks of a workload.
+///
+/// \param events The events to be scheduled.
+/// \param count The amount of events in the batch.
+ENGINE_INLINE void schedule_events(const ScheduledEvent *events,
+                                   const std::size_t     count)
+{
+    if (native::g_Active) {
+        native::schedule_events(events, count);
+        return;
+    }
+
+#ifdef ROOTSIM_ENGINE
+    for (std::size_t i = 0; i < count; i++)
+        rootsim::schedule_event(events[i].m_Receiver,
+                                events[i].m_Time,
+                                events[i].m_Type,
+                                events[i].m_Content,
+                                events[i].m_Size);
+#endif // ROOT-Sim
+}
+
+/// \brief Returns a pseudo-random number uniformly distributed in [0, 1).
+///
+/// The number is drawn from the random stream of the service being currently
+/// processed, such that, the same model produces the same results regardless
+/// of the order in which the services are processed.
+ENGINE_INLINE double random()
+{
+    if (native::g_Active)
+        return native::random();
+
+#ifdef ROOTSIM_ENGINE
+    return Random();
+#else
+    // There is no underlying simulator that could draw the number.
+    die("A random number has been requested outside of the native engine, "
+        "but no underlying simulator has been selected.");
+    return 0.0;
+#endif // ROOT-Sim
+}
+
+/// \brief Returns the storage in which an event handler saves the values that
+///        it overwrites and that cannot be recomputed by its reverse handler.
+///
+/// The storage is attached to the event being currently processed. Therefore,
+/// when the event is reversed, the reverse handler obtains the same storage
+/// and, hence, the values saved by the forward handler. The engines that do
+/// not roll back events by reverse computation provide a scratch storage.
+///
+/// \tparam T The type of the saved data.
+///
+/// \return A pointer to the reverse data storage.
+template <typename T>
+ENGINE_INLINE T *reverse_data()
+{
+    static_assert(sizeof(T) <= ENGINE_MAX_REVERSE_DATA_SIZE,
+                  "The reverse data does not fit in the reverse data storage.");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "The reverse data must be trivially copyable.");
+
+    return static_cast<T *>(native::reverse_data());
+}
 } // namespace ispd
 
 #endif // ENGINE_HPP
@@ -3,11 +3,21 @@
 
 #include <core/core.hpp>
 #include <customer/customer.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <routing/forwarding.hpp>
+#include <routing/provider.hpp>
 #include <routing/route.hpp>
 
 /**
  * @brief An event (or message) is the smallest unit of information
  *        that is exchanged between service centers.
+ *
+ * @details
+ *        The event is copied on every hop, queued by the engines and saved in
+ *        the checkpoints, therefore, it is kept compact. The services'
+ *        identifiers are stored in 32 bits, the route offset in 16 bits and
+ *        the completion state in 8 bits.
  */
 struct Event
 {
@@ -51,9 +61,167 @@ public:
         return m_RouteDescriptor;
     }
 
-private:
+    /**
+     * @brief Returns the service's identifier at the specified offset of the
+     *        route that is described by the event's route descriptor.
+     *
+     *        If the route is carried inline in the event, then it is read
+     *        from the event itself. Otherwise, it is obtained from the global
+     *        route provider.
+     *
+     * @param offset the offset in the route
+     *
+     * @return the service's identifier at the specified offset of the route
+     */
+    ENGINE_INLINE uint32_t getHop(std::size_t offset) const;
+
+    /**
+     * @brief Returns the next service to which the specified service must
+     *        send the event, which is obtained from the global forwarding
+     *        table.
+     *
+     *        The event travels towards its route's destination if it is in the
+     *        forwarding direction. Otherwise, it travels back towards its
+     *        route's source.
+     *
+     * @param service the identifier of the service that sends the event
+     *
+     * @return the next service's identifier
+     */
+    ENGINE_INLINE uint32_t getNextHop(const uint32_t service) const
+    {
+        const auto target = m_RouteDescriptor.getForwardingDirection()
+                                ? m_RouteDescriptor.getDestination()
+                                : m_RouteDescriptor.getSource();
+
+        return g_ForwardingTable->getNextHop(service,
+                                             static_cast<uint32_t>(target));
+    }
+
+protected:
     Task            m_Task;
     RouteDescriptor m_RouteDescriptor;
 };
 
+static_assert(sizeof(Event) == 48,
+              "The event wire format must be kept compact (48 bytes).");
+
+/**
+ * @brief An event that carries the path of its route inline (source routing).
+ *
+ * @details
+ *        If the route has at most `InlineRouteMaxLength` services, then its
+ *        path is copied once to the event by the service that originates it,
+ *        and every service that forwards the event reads the next service
+ *        from the event itself, without touching the route provider. The
+ *        amount of services carried inline is stored in the route
+ *        descriptor. Otherwise, the event is an ordinary event and the
+ *        services are obtained from the route provider on each hop. No
+ *        route is carried inline if the global forwarding table is set.
+ *
+ *        Only the services carried inline are sent (see `getSize`), hence,
+ *        an event without an inline route is sent with the same size of an
+ *        ordinary event.
+ */
+class SourceRoutedEvent : public Event
+{
+public:
+    /**
+     * @brief Constructs an event that starts to travel the route between the
+     *        source and destination services of the specified route
+     *        descriptor, carrying the route inline if it is short enough.
+     *
+     * @param task the task
+     * @param routeDescriptor the route descriptor
+     */
+    explicit SourceRoutedEvent(const Task            &task,
+                               const RouteDescriptor &routeDescriptor)
+        : Event(task, routeDescriptor)
+    {
+        // The services only read the route when the packets are not forwarded
+        // through the forwarding table, therefore, it is only inlined then.
+        if (g_ForwardingTable)
+            return;
+
+        const Route route = g_RouteProvider->getRoute(
+            static_cast<uint32_t>(routeDescriptor.getSource()),
+            static_cast<uint32_t>(routeDescriptor.getDestination()),
+            task.getTid());
+
+        if (route.getLength() > InlineRouteMaxLength)
+            return;
+
+        for (std::size_t i = 0; i < route.getLength(); i++)
+            m_Hops[i] = route[i];
+
+        m_RouteDescriptor.m_InlineLength =
+            static_cast<uint8_t>(route.getLength());
+    }
+
+    /**
+     * @brief Constructs an event that continues to travel the route of the
+     *        specified received event, carrying the same route inline, if
+     *        the received event carries it.
+     *
+     * @param task the task
+     * @param routeDescriptor the route descriptor, whose source and
+     *                        destination services must be the same of the
+     *                        received event's route descriptor
+     * @param received the received event
+     */
+    explicit SourceRoutedEvent(const Task            &task,
+                               const RouteDescriptor &routeDescriptor,
+                               const Event           &received)
+        : Event(task, routeDescriptor)
+    {
+        const std::size_t length =
+            received.getRouteDescriptor().getInlineLength();
+
+        // The received event is only a source routed event if it carries its
+        // route inline, therefore, its hops are only read in such case.
+        if (length > 0U) {
+            const auto &hops = static_cast<const SourceRoutedEvent &>(received);
+
+            for (std::size_t i = 0; i < length; i++)
+                m_Hops[i] = hops.m_Hops[i];
+        }
+
+        m_RouteDescriptor.m_InlineLength = static_cast<uint8_t>(length);
+    }
+
+    /**
+     * @brief Returns the size (in bytes) of the event content that must be
+     *        sent, which is the ordinary event followed by the services
+     *        carried inline.
+     *
+     * @return the size of the event content that must be sent
+     */
+    ENGINE_INLINE std::size_t getSize() const
+    {
+        return sizeof(Event) +
+               m_RouteDescriptor.getInlineLength() * sizeof(uint32_t);
+    }
+
+private:
+    friend struct Event;
+
+    uint32_t m_Hops[InlineRouteMaxLength] = {};
+};
+
+static_assert(sizeof(SourceRoutedEvent) ==
+                  sizeof(Event) + InlineRouteMaxLength * sizeof(uint32_t),
+              "The inline route must immediately follow the event.");
+
+ENGINE_INLINE uint32_t Event::getHop(const std::size_t offset) const
+{
+    if (m_RouteDescriptor.getInlineLength() > 0U)
+        return static_cast<const SourceRoutedEvent *>(this)->m_Hops[offset];
+
+    return g_RouteProvider->getHop(
+        static_cast<uint32_t>(m_RouteDescriptor.getSource()),
+        static_cast<uint32_t>(m_RouteDescriptor.getDestination()),
+        offset,
+        m_Task.getTid());
+}
+
 #endif // ENGINE_EVENT_HPP
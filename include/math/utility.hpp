@@ -20,4 +20,20 @@ ENGINE_INLINE static uint64_t szudzik(const uint32_t a, const uint32_t b)
     return a64 >= b64 ? a64 * a64 + a64 + b64 : a64 + b64 * b64;
 }
 
+/**
+ * @brief The SplitMix64's finalizer, which mixes the bits of an unsigned
+ *        64-bit integer, such that, close integers are mapped to unrelated
+ *        ones.
+ *
+ * @param x the unsigned 64-bit integer
+ *
+ * @return the mixed unsigned 64-bit integer
+ */
+ENGINE_INLINE static uint64_t mix64(uint64_t x)
+{
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31U);
+}
+
 #endif // ENGINE_MATH_UTILITY_HPP
@@ -69,11 +69,34 @@ public:
      * @param power the machine's power in megaflops/s
      * @param loadFactor the machine's load factor
      * @param cores the machine's amount of cores
+     * @param selection the way in which the machine selects the core that
+     *                  processes each task
      */
-    void registerMachine(const sid_t  machineId,
-                         const double power,
-                         const double loadFactor,
-                         const int    cores);
+    void registerMachine(
+        const sid_t         machineId,
+        const double        power,
+        const double        loadFactor,
+        const int           cores,
+        const CoreSelection selection = CoreSelection::AUTOMATIC);
+
+    /**
+     * @brief Registers a service of type processor-sharing machine in the
+     *        model to be simulated with the specified machine identifier,
+     *        power, load factor and cores.
+     *
+     * @details
+     *        The machine's cores are equally shared among every task that it
+     *        is processing (see `SharingMachine`).
+     *
+     * @param machineId the machine's identifier
+     * @param power the machine's power in megaflops/s
+     * @param loadFactor the machine's load factor
+     * @param cores the machine's amount of cores
+     */
+    void registerSharingMachine(const sid_t  machineId,
+                                const double power,
+                                const double loadFactor,
+                                const int    cores);
 
     /**
      * @brief Registers a service of type link in the model to be simulated
@@ -87,13 +110,16 @@ public:
      * @param bandwdith the bandwidth in megabits/s
      * @param loadFactor the load factor
      * @param latency the latency in seconds
+     * @param duplex the way in which the bandwidth is shared between the
+     *               link's directions
      */
-    void registerLink(const sid_t  linkId,
-                      const sid_t  from,
-                      const sid_t  to,
-                      const double bandwidth,
-                      const double loadFactor,
-                      const double latency);
+    void registerLink(const sid_t      linkId,
+                      const sid_t      from,
+                      const sid_t      to,
+                      const double     bandwidth,
+                      const double     loadFactor,
+                      const double     latency,
+                      const LinkDuplex duplex = LinkDuplex::HALF);
 
     /**
      * Registers a service of the type switch in the model to be simulated with the specifed
@@ -109,6 +135,32 @@ public:
                           const double latency);
 
 
+    /**
+     * @brief Registers a service of type cluster in the model to be simulated
+     *        with the specified cluster identifier, the amount of machines,
+     *        and the parameters of each machine and of each access link.
+     *
+     * @details
+     *        The masters schedule the cluster's machines as slaves through
+     *        `Master::addClusterSlaves`.
+     *
+     * @param clusterId the cluster's identifier
+     * @param machines the amount of machines, in the interval [1, 65536]
+     * @param power each machine's power in megaflops/s
+     * @param loadFactor each machine's load factor
+     * @param cores each machine's amount of cores
+     * @param linkBandwidth each access link's bandwidth in megabits/s
+     * @param linkLoadFactor each access link's load factor
+     * @param linkLatency each access link's latency in seconds
+     */
+    void registerCluster(const sid_t    clusterId,
+                         const uint32_t machines,
+                         const double   power,
+                         const double   loadFactor,
+                         const int      cores,
+                         const double   linkBandwidth,
+                         const double   linkLoadFactor,
+                         const double   linkLatency);
 
     void registerDummy(const sid_t dummyId);
 
@@ -135,19 +187,31 @@ namespace zeroth
  *
  *        Moreover, if the `jittered` is false, then all tasks will arrive
  *        in the master at timestamp `0.0`, otherwise, the i-th task will arrive
- *        at the timestamp of the previous task plus `1e-52`. This is done to
- *        imitates that all tasks is still arriving at `0.0` but ensuring the
- *        total ordering of events with relation in its generation order.
+ *        at the next representable timestamp after the previous task's one.
+ *        This is done to imitates that all tasks is still arriving at `0.0`
+ *        but ensuring the total ordering of events with relation in its
+ *        generation order.
+ *
+ *        The native engine already delivers the events with the same timestamp
+ *        in the order in which they have been scheduled by the same service,
+ *        therefore, the jitter is only needed by the ROOT-Sim. Further, if
+ *        the native engine is built with `NATIVE_FIXED_POINT_TIME=1`, then it
+ *        rounds the timestamps to its fixed-point ticks, which are much
+ *        coarser than the jitter, such that, the jittered tasks are tied.
+ *
+ *        The tasks are injected as events, therefore, this function must be
+ *        called while the master is initialized (see `Builder::registerMaster`)
+ *        and the master is not quiescent until every task has arrived (see
+ *        `Master::addPendingArrivals`).
  *
- * @param masterId the master identifier which represents the master that
- *                 will receive these tasks
+ * @param master the master that will receive these tasks
  * @param processingSize the tasks' processing size in megaflops
  * @param communicationSize the tasks' communication size in megabits
  * @param taskAmount the amount of tasks that will be generated
  * @param jittered it indicates if the events carrying those tasks will be
  *                 jittered or not.
  */
-void addConstantSizedWorkload(const sid_t    masterId,
+void addConstantSizedWorkload(Master        *master,
                               const double   processingSize,
                               const double   communicationSize,
                               const uint32_t taskAmount,
@@ -157,7 +221,20 @@ void addConstantSizedWorkload(const sid_t    masterId,
 
 namespace exp
 {
-void addConstantSizedWorkload(const sid_t    masterId,
+
+/**
+ * @brief Adds a constant size workload to the specified master, whose tasks
+ *        arrive at exponentially distributed times with mean `5.0`.
+ *
+ *        As in `zeroth::addConstantSizedWorkload`, this function must be
+ *        called while the master is initialized.
+ *
+ * @param master the master that will receive these tasks
+ * @param processingSize the tasks' processing size in megaflops
+ * @param communicationSize the tasks' communication size in megabits
+ * @param taskAmount the amount of tasks that will be generated
+ */
+void addConstantSizedWorkload(Master        *master,
                               const double   processingSize,
                               const double   communicationSize,
                               const uint32_t taskAmount);
@@ -0,0 +1,167 @@
+#ifndef ENGINE_ROUTING_FORWARDING_HPP
+#define ENGINE_ROUTING_FORWARDING_HPP
+
+#include <algorithm>
+#include <core/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <routing/provider.hpp>
+#include <vector>
+
+namespace ispd::sim
+{
+class ServiceTable;
+}
+
+/**
+ * @brief A forwarding table maps, for each service, the destination of a
+ *        packet to the next service to which the packet must be sent
+ *        (next-hop routing).
+ *
+ * @details
+ *        Unlike the route providers, that store or compute the whole path
+ *        between a source and a destination, each service only knows the
+ *        link through which a packet leaves it towards each destination.
+ *        Therefore, the packets do not have to carry their position in the
+ *        route, and a packet that travels back to its source is forwarded in
+ *        the same way, with its source as the destination.
+ *
+ *        The table is built once from the links that have been registered in
+ *        the service table, by computing the shortest path tree rooted at
+ *        each destination. Since every service sends the packets towards a
+ *        destination through the same tree, the routes are always consistent
+ *        among the services. Only the machines and the switches forward the
+ *        packets, as in the shortest path route provider.
+ *
+ *        The packets are never destined to a switch, therefore, a tree is
+ *        only computed for the other services. Building the table with D such
+ *        destinations, N services that are the endpoint of some link and E
+ *        links takes O(D * (E log E + N)) time, since a full shortest path
+ *        search is run from each destination. Hence, it is meant for models
+ *        with up to a few tens of thousands of services. The larger regular
+ *        topologies should compute their routes in a closed form instead
+ *        (see `ImplicitRouteProvider`).
+ *
+ *        The table of each service is range compressed, that is, each entry
+ *        maps a block of consecutive destinations that share the same next
+ *        service. Since the services of the regular topologies are numbered
+ *        in contiguous blocks, the amount of entries of a service is usually
+ *        proportional to its amount of links, and the memory used scales with
+ *        the amount of services times their amount of links, instead of with
+ *        the sum of the routes' lengths.
+ */
+class ForwardingTable
+{
+public:
+    /**
+     * @brief Builds the forwarding tables of every service from the links
+     *        that have been registered in the specified service table.
+     *
+     * @details
+     *        The links registered after the construction are not taken into
+     *        account.
+     *
+     * @param services the service table
+     * @param metric the metric that is minimized by the routes
+     */
+    explicit ForwardingTable(const ispd::sim::ServiceTable &services,
+                             RouteMetric metric = RouteMetric::HOPS);
+
+    /**
+     * @brief Returns the next service to which the specified service must
+     *        send a packet destined to the specified destination.
+     *
+     *        However, if the destination is not reachable from the service,
+     *        if any of them is not an endpoint of some link (e.g., it is a
+     *        link), or if the destination is a switch, then the program is
+     *        immediately aborted.
+     *
+     * @param service the identifier of the service that sends the packet
+     * @param dest the identifier of the packet's destination
+     *
+     * @return the next service's identifier
+     */
+    ENGINE_INLINE uint32_t getNextHop(const uint32_t service,
+                                      const uint32_t dest) const
+    {
+        // It checks if the service has no forwarding table, if the packet is
+        // destined to the service itself or to a service that may not be a
+        // destination. If so, the program is immediately aborted.
+        if (UNLIKELY(service + 1ULL >= m_Offsets.size() || service == dest ||
+                     dest >= m_IsDestination.size() || !m_IsDestination[dest]))
+            die("No route from %u to %u has been found.", service, dest);
+
+        const uint32_t *starts = m_RangeStarts.data();
+        const uint32_t *first  = starts + m_Offsets[service];
+        const uint32_t *last   = starts + m_Offsets[service + 1];
+
+        // The range that contains the destination is the last one that starts
+        // before or at the destination.
+        const uint32_t *range = std::upper_bound(first, last, dest);
+        const uint32_t  hop =
+            range == first ? NoHop : m_NextHops[range - starts - 1];
+
+        if (UNLIKELY(hop == NoHop))
+            die("No route from %u to %u has been found.", service, dest);
+
+        return hop;
+    }
+
+    /**
+     * @brief Returns the amount of entries of all services' tables, that
+     *        is, the amount of ranges of destinations.
+     */
+    ENGINE_INLINE std::size_t getEntryCount() const
+    {
+        return m_RangeStarts.size();
+    }
+
+private:
+    /**
+     * @brief The indicator of a destination that is not reachable.
+     */
+    static constexpr uint32_t NoHop = UINT32_MAX;
+
+    /**
+     * @brief Indicates, for each service, whether it may be a packet's
+     *        destination, that is, it is the endpoint of some link and it is
+     *        not a switch.
+     */
+    std::vector<bool> m_IsDestination;
+
+    /**
+     * @brief The offsets of each service's entries. The entries of the i-th
+     *        service are in the range [m_Offsets[i], m_Offsets[i + 1]).
+     */
+    std::vector<uint64_t> m_Offsets;
+
+    /**
+     * @brief The first destination of each entry's range, sorted within each
+     *        service. A range ends where the next range of the same service
+     *        starts.
+     *
+     *        The identifiers that are not destinations, as the links' and the
+     *        switches' identifiers and the service's own identifier, belong to
+     *        whatever range contains them, such that, they never split a
+     *        range. They are rejected through `m_IsDestination` instead.
+     */
+    std::vector<uint32_t> m_RangeStarts;
+
+    /**
+     * @brief The next service of each entry, or `NoHop` if the entry's
+     *        destinations are not reachable.
+     */
+    std::vector<uint32_t> m_NextHops;
+};
+
+/**
+ * @brief The global forwarding table that is used by all services that are
+ *        located in this physical process.
+ *
+ * @details
+ *        If it is set, then the services forward the packets through the
+ *        next-hop routing instead of the global route provider.
+ */
+extern ForwardingTable *g_ForwardingTable;
+
+#endif // ENGINE_ROUTING_FORWARDING_HPP
@@ -0,0 +1,314 @@
+#ifndef ENGINE_ROUTING_IMPLICIT_HPP
+#define ENGINE_ROUTING_IMPLICIT_HPP
+
+#include <algorithm>
+#include <core/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <routing/provider.hpp>
+
+/**
+ * @brief An implicit route provider computes the routes of a regular topology
+ *        in a closed form from the services' identifiers.
+ *
+ * @details
+ *        There is no routing table at all, therefore, the memory used for
+ *        routing is constant regardless of the amount of services. Each
+ *        element of a route is computed directly from the source service, the
+ *        destination service and the element's offset (see `getHop`).
+ *
+ *        Since the services' identifiers carry the topology's structure, each
+ *        implicit provider defines how the services and the links of its
+ *        topology must be numbered when they are registered.
+ *
+ *        The routes are only materialized when they are requested as a whole
+ *        (see `getRoute`), in which case they are stored in a buffer that is
+ *        private to each thread.
+ */
+class ImplicitRouteProvider : public RouteProvider
+{
+public:
+    /**
+     * @brief Returns the route between the specified source and destination
+     *        services, which is materialized in the calling thread's buffer.
+     *
+     *        However, if there is no route between these services, then the
+     *        program is immediately aborted.
+     */
+    Route getRoute(uint32_t src, uint32_t dest) const override;
+
+    std::size_t getLength(uint32_t src, uint32_t dest) const override = 0;
+
+    uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const override = 0;
+};
+
+/**
+ * @brief An implicit route provider for the star topology, either with a
+ *        master at its hub or with a switch at its hub.
+ *
+ * @details
+ *        The topology is composed by `n` nodes. The i-th node has the
+ *        identifier `2i`, and the link between the i-th node and the hub has
+ *        the identifier `2i - 1`.
+ *
+ *        In the star, the hub is the node 0. In the switched star, the hub is
+ *        the node 1 (a switch), and the node 0 (the master) is connected to
+ *        the hub by the link 1.
+ *
+ *          star:           0 -1- 2,  0 -3- 4,  0 -5- 6, ...
+ *          switched star:  0 -1- 2,  2 -3- 4,  2 -5- 6, ...
+ */
+class StarRouteProvider final : public ImplicitRouteProvider
+{
+public:
+    /**
+     * @param nodeCount the amount of nodes, including the hub
+     * @param switched true if the hub is the node 1 instead of the node 0
+     */
+    explicit StarRouteProvider(uint32_t nodeCount, bool switched = false);
+
+    std::size_t getLength(uint32_t src, uint32_t dest) const override;
+
+    uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const override;
+
+private:
+    /**
+     * @brief Returns the node index of the specified service, aborting the
+     *        program if the service is not a node of this topology.
+     */
+    uint32_t toNode(uint32_t serviceId) const;
+
+    /**
+     * @brief Returns the identifier of the link between the specified node
+     *        and the hub.
+     */
+    ENGINE_INLINE uint32_t getLinkId(const uint32_t node) const
+    {
+        return 2U * std::max(node, m_Hub) - 1U;
+    }
+
+    uint32_t m_NodeCount;
+    uint32_t m_Hub;
+};
+
+/**
+ * @brief An implicit route provider for the complete k-ary tree topology.
+ *
+ * @details
+ *        The topology is composed by `n` nodes in the breadth-first order,
+ *        such that, the parent of the i-th node (i > 0) is the node
+ *        `(i - 1) / k`. The i-th node has the identifier `2i`, and the link
+ *        between the i-th node and its parent has the identifier `2i - 1`.
+ *
+ *        The route between two nodes goes up to their lowest common ancestor
+ *        and, then, down to the destination. Each element is computed in
+ *        O(log_k n) time.
+ */
+class KaryTreeRouteProvider final : public ImplicitRouteProvider
+{
+public:
+    /**
+     * @param nodeCount the amount of nodes
+     * @param arity the amount of children of each inner node
+     */
+    explicit KaryTreeRouteProvider(uint32_t nodeCount, uint32_t arity);
+
+    std::size_t getLength(uint32_t src, uint32_t dest) const override;
+
+    uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const override;
+
+private:
+    /**
+     * @brief Returns the node index of the specified service, aborting the
+     *        program if the service is not a node of this topology.
+     */
+    uint32_t toNode(uint32_t serviceId) const;
+
+    /**
+     * @brief Returns the depth of the specified node.
+     */
+    uint32_t getDepth(uint32_t node) const;
+
+    /**
+     * @brief Returns the ancestor of the specified node that is the specified
+     *        amount of levels above it.
+     */
+    uint32_t getAncestor(uint32_t node, uint32_t levels) const;
+
+    uint32_t m_NodeCount;
+    uint32_t m_Arity;
+};
+
+/**
+ * @brief An implicit route provider for the torus (or mesh) topology with
+ *        one, two or three dimensions.
+ *
+ * @details
+ *        The topology is composed by the `X * Y * Z` nodes of a grid, in
+ *        which the node at the coordinates (x, y, z) is the i-th node, with
+ *        `i = x + X * (y + Y * z)`. The i-th node has the identifier
+ *        `(D + 1) * i`, where `D` is the amount of dimensions, and the link
+ *        that connects the i-th node to its successor in the d-th dimension
+ *        has the identifier `(D + 1) * i + 1 + d`. In the torus, the last
+ *        node of each dimension is connected to the first one.
+ *
+ *        Therefore, the ring is the torus with one dimension, and the linear
+ *        topology is the mesh with one dimension.
+ *
+ *          ring:  0 -1- 2 -3- 4 -5- ... -(2X - 1)- 0
+ *
+ *        The routes are computed by the dimension-ordered routing, that is,
+ *        the packet is forwarded in the first dimension until it reaches the
+ *        destination's coordinate, then in the second dimension, and so on.
+ *        In the torus, the shortest direction of each dimension is taken,
+ *        and the ties are broken by the successor's direction.
+ */
+class TorusRouteProvider final : public ImplicitRouteProvider
+{
+public:
+    /**
+     * @param dimensions the amount of dimensions, from 1 to 3
+     * @param extents the amount of nodes in each dimension
+     * @param wraparound true for the torus, false for the mesh
+     */
+    explicit TorusRouteProvider(uint32_t        dimensions,
+                                const uint32_t *extents,
+                                bool            wraparound = true);
+
+    std::size_t getLength(uint32_t src, uint32_t dest) const override;
+
+    uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const override;
+
+private:
+    /**
+     * @brief Decodes the coordinates of the specified service, aborting the
+     *        program if the service is not a node of this topology.
+     */
+    void toCoordinates(uint32_t serviceId, uint32_t *coordinates) const;
+
+    /**
+     * @brief Returns the amount of steps and the direction that a packet
+     *        takes in the specified dimension between two coordinates.
+     */
+    uint32_t getSteps(uint32_t  dimension,
+                      uint32_t  from,
+                      uint32_t  to,
+                      bool     &successor) const;
+
+    uint32_t m_Dimensions;
+    uint32_t m_Extents[3];
+    uint64_t m_NodeCount;
+    bool     m_Wraparound;
+};
+
+/**
+ * @brief An implicit route provider for the k-ary fat-tree topology.
+ *
+ * @details
+ *        The fat-tree (k even) is composed by `k` pods, each one with `k/2`
+ *        edge switches and `k/2` aggregation switches, by `(k/2)^2` core
+ *        switches, and by `k^3/4` hosts, `k/2` per edge switch. The j-th
+ *        aggregation switch of each pod is connected to the core switches
+ *        `j * k/2` to `(j + 1) * k/2 - 1`.
+ *
+ *        The services are numbered in contiguous blocks, in the following
+ *        order, whose identifiers are given by the getters of this class.
+ *
+ *          hosts, edge switches, aggregation switches, core switches,
+ *          host links, edge links, core links
+ *
+ *        Only the routes between two hosts are defined. The upward path is
+ *        selected by the destination host (D-mod-k routing), such that, the
+ *        routes to the different hosts are spread among the core switches.
+ */
+class FatTreeRouteProvider final : public ImplicitRouteProvider
+{
+public:
+    /**
+     * @param arity the amount of ports of each switch, which must be even
+     */
+    explicit FatTreeRouteProvider(uint32_t arity);
+
+    std::size_t getLength(uint32_t src, uint32_t dest) const override;
+
+    uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const override;
+
+    ENGINE_INLINE uint32_t getHostCount() const
+    {
+        return m_HostCount;
+    }
+
+    ENGINE_INLINE uint32_t getHostId(const uint32_t host) const
+    {
+        return host;
+    }
+
+    ENGINE_INLINE uint32_t getEdgeSwitchId(const uint32_t pod,
+                                           const uint32_t edge) const
+    {
+        return m_HostCount + pod * m_Half + edge;
+    }
+
+    ENGINE_INLINE uint32_t getAggregationSwitchId(const uint32_t pod,
+                                                  const uint32_t aggr) const
+    {
+        return m_HostCount + m_PodSwitchCount + pod * m_Half + aggr;
+    }
+
+    ENGINE_INLINE uint32_t getCoreSwitchId(const uint32_t aggr,
+                                           const uint32_t port) const
+    {
+        return m_HostCount + 2U * m_PodSwitchCount + aggr * m_Half + port;
+    }
+
+    /**
+     * @brief Returns the identifier of the link between the specified host
+     *        and its edge switch.
+     */
+    ENGINE_INLINE uint32_t getHostLinkId(const uint32_t host) const
+    {
+        return m_SwitchEnd + host;
+    }
+
+    /**
+     * @brief Returns the identifier of the link between the specified edge
+     *        switch and the specified aggregation switch of the same pod.
+     */
+    ENGINE_INLINE uint32_t getEdgeLinkId(const uint32_t pod,
+                                         const uint32_t edge,
+                                         const uint32_t aggr) const
+    {
+        return m_SwitchEnd + m_HostCount + (pod * m_Half + edge) * m_Half +
+               aggr;
+    }
+
+    /**
+     * @brief Returns the identifier of the link between the specified
+     *        aggregation switch and the specified port's core switch.
+     */
+    ENGINE_INLINE uint32_t getCoreLinkId(const uint32_t pod,
+                                         const uint32_t aggr,
+                                         const uint32_t port) const
+    {
+        return m_SwitchEnd + 2U * m_HostCount + (pod * m_Half + aggr) * m_Half +
+               port;
+    }
+
+private:
+    /**
+     * @brief Aborts the program if the specified service is not a host.
+     */
+    void checkHost(uint32_t serviceId) const;
+
+    uint32_t m_Half;
+    uint32_t m_HostCount;
+    uint32_t m_PodSwitchCount;
+    uint32_t m_SwitchEnd;
+};
+
+#endif // ENGINE_ROUTING_IMPLICIT_HPP
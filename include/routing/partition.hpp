@@ -0,0 +1,105 @@
+#ifndef ENGINE_ROUTING_PARTITION_HPP
+#define ENGINE_ROUTING_PARTITION_HPP
+
+#include <core/core.hpp>
+#include <cstdint>
+#include <routing/table.hpp>
+
+namespace ispd::sim
+{
+class ServiceTable;
+}
+
+/**
+ * @brief A partition map assigns each service to the rank (process) of a
+ *        distributed simulation that hosts it.
+ *
+ * @details
+ *        The services are assigned in contiguous blocks of similar sizes, in
+ *        the same way that ROOT-Sim assigns the logical processes to the
+ *        ranks, that is, the service `s` is hosted by the rank
+ *        `s * rankCount / serviceCount`.
+ *
+ *        The partition map is used to shard the routing table, such that,
+ *        each rank only loads the routes that its own services look up (see
+ *        `makeRouteFilter`). Therefore, the memory used by the routes is
+ *        divided among the ranks, instead of being replicated in each one.
+ */
+class PartitionMap
+{
+public:
+    /**
+     * @param rank the rank of this process
+     * @param rankCount the amount of ranks
+     * @param serviceCount the amount of services, that is, one more than the
+     *                     greatest service's identifier
+     */
+    explicit PartitionMap(uint32_t rank,
+                          uint32_t rankCount,
+                          uint64_t serviceCount);
+
+    /**
+     * @brief Constructs the partition map of this process, whose rank and
+     *        amount of ranks are read from the environment variables set by
+     *        the MPI launchers (Open MPI, MPICH and Slurm).
+     *
+     * @details
+     *        The routing table is loaded before the simulation is initialized
+     *        and, therefore, before the MPI is initialized. If no launcher's
+     *        variable is set, then this process is the only rank.
+     *
+     * @param serviceCount the amount of services
+     */
+    static PartitionMap fromEnvironment(uint64_t serviceCount);
+
+    /**
+     * @brief Returns the rank that hosts the specified service.
+     */
+    ENGINE_INLINE uint32_t getRank(const uint64_t serviceId) const
+    {
+        return static_cast<uint32_t>(serviceId * m_RankCount / m_ServiceCount);
+    }
+
+    /**
+     * @brief Returns true if the specified service is hosted by this rank.
+     */
+    ENGINE_INLINE bool isLocal(const uint64_t serviceId) const
+    {
+        return getRank(serviceId) == m_Rank;
+    }
+
+    ENGINE_INLINE uint32_t getLocalRank() const
+    {
+        return m_Rank;
+    }
+
+    ENGINE_INLINE uint32_t getRankCount() const
+    {
+        return m_RankCount;
+    }
+
+    /**
+     * @brief Returns the route filter that keeps the routes that are looked
+     *        up by the services hosted by this rank.
+     *
+     * @details
+     *        A route is looked up by its source and by its destination, which
+     *        send the packets, and by the machines and the switches that
+     *        forward the packets, which are the endpoints of the links in the
+     *        route. Hence, a route is kept if its source, its destination or
+     *        any endpoint of any of its alternatives' links is hosted by this
+     *        rank. Every lookup made by a local service is served by the
+     *        local shard, and no remote lookup is ever needed.
+     *
+     * @param services the service table, in which every link has already
+     *                 been registered
+     */
+    RouteFilter makeRouteFilter(const ispd::sim::ServiceTable &services) const;
+
+private:
+    uint32_t m_Rank;
+    uint32_t m_RankCount;
+    uint64_t m_ServiceCount;
+};
+
+#endif // ENGINE_ROUTING_PARTITION_HPP
@@ -0,0 +1,158 @@
+#ifndef ENGINE_ROUTING_PROVIDER_HPP
+#define ENGINE_ROUTING_PROVIDER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <routing/route.hpp>
+
+/**
+ * @brief The metric that is minimized by the shortest path routes.
+ */
+enum class RouteMetric : uint8_t
+{
+    /**
+     * @brief The amount of links in the route.
+     */
+    HOPS,
+
+    /**
+     * @brief The sum of the links' latencies.
+     */
+    LATENCY,
+
+    /**
+     * @brief The sum of the links' inverse bandwidths, that is, the time to
+     *        transmit one unit of data through every link in the route.
+     */
+    BANDWIDTH
+};
+
+/**
+ * @brief A route provider is used by the services to obtain the route between
+ *        two services when forwarding a packet.
+ *
+ * @details
+ *        The routes may be stored in a table, computed on demand or computed
+ *        in a closed form from the services' identifiers. Therefore, the
+ *        route returned by a provider is only guaranteed to remain valid until
+ *        the next call to the provider in the same thread.
+ *
+ *        The providers are shared by every thread progressing the simulation
+ *        and, therefore, they must be thread-safe.
+ */
+class RouteProvider
+{
+public:
+    virtual ~RouteProvider() = default;
+
+    /**
+     * @brief Returns the route between the specified source and destination
+     *        services.
+     *
+     *        However, if there is no route between these services, then the
+     *        program is immediately aborted.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     *
+     * @return the route between the specified source and destination
+     *         services
+     */
+    virtual Route getRoute(uint32_t src, uint32_t dest) const = 0;
+
+    /**
+     * @brief Returns the length of the route between the specified source
+     *        and destination services.
+     *
+     *        By default, the route is retrieved and its length is returned.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     *
+     * @return the length of the route between the specified source and
+     *         destination services
+     */
+    virtual std::size_t getLength(uint32_t src, uint32_t dest) const
+    {
+        return getRoute(src, dest).getLength();
+    }
+
+    /**
+     * @brief Returns the service's identifier of the element at the specified
+     *        offset of the route between the specified source and destination
+     *        services.
+     *
+     *        By default, the route is retrieved and the element is indexed.
+     *        However, the providers that compute the routes in a closed form
+     *        compute the element directly, without materializing the route.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     * @param offset the element's offset in the route
+     *
+     * @return the service's identifier of the route's element
+     */
+    virtual uint32_t
+    getHop(uint32_t src, uint32_t dest, std::size_t offset) const
+    {
+        return getRoute(src, dest)[offset];
+    }
+
+    /**
+     * @brief Returns the route between the specified source and destination
+     *        services that is taken by the packets of the specified flow.
+     *
+     *        The providers that store several equal-cost routes between two
+     *        services select one of them by the flow, such that, the packets
+     *        of the same flow always take the same route. By default, there
+     *        is a single route between two services and the flow is ignored.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     * @param flow the flow's identifier (e.g., the task's identifier)
+     *
+     * @return the route taken by the packets of the specified flow
+     */
+    virtual Route
+    getRoute(uint32_t src, uint32_t dest, [[maybe_unused]] uint64_t flow) const
+    {
+        return getRoute(src, dest);
+    }
+
+    /**
+     * @brief Returns the length of the route between the specified source
+     *        and destination services that is taken by the packets of the
+     *        specified flow.
+     *
+     *        By default, the flow is ignored.
+     */
+    virtual std::size_t getLength(uint32_t                  src,
+                                  uint32_t                  dest,
+                                  [[maybe_unused]] uint64_t flow) const
+    {
+        return getLength(src, dest);
+    }
+
+    /**
+     * @brief Returns the service's identifier of the element at the specified
+     *        offset of the route between the specified source and destination
+     *        services that is taken by the packets of the specified flow.
+     *
+     *        By default, the flow is ignored.
+     */
+    virtual uint32_t getHop(uint32_t                  src,
+                            uint32_t                  dest,
+                            std::size_t               offset,
+                            [[maybe_unused]] uint64_t flow) const
+    {
+        return getHop(src, dest, offset);
+    }
+};
+
+/**
+ * @brief The global route provider that is used by all services that are
+ *        located in this physical process.
+ */
+extern RouteProvider *g_RouteProvider;
+
+#endif // ENGINE_ROUTING_PROVIDER_HPP
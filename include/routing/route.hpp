@@ -2,8 +2,21 @@
 #define ENGINE_ROUTING_ROUTE_HPP
 
 #include <core/core.hpp>
+#include <cstddef>
 #include <cstdint>
 
+/**
+ * @brief The greatest amount of services in a route, such that, every offset
+ *        in the route fits in the route descriptor.
+ */
+constexpr std::size_t RouteMaxLength = UINT16_MAX;
+
+/**
+ * @brief The greatest amount of services in a route that is carried inline in
+ *        the events (see `SourceRoutedEvent`).
+ */
+constexpr std::size_t InlineRouteMaxLength = 8U;
+
 /**
  * @brief A route descriptor.
  *
@@ -27,6 +40,9 @@
  *          `offset: Once we have the route between these two services, this
  *                   information is used to identify which service in the route
  *                   is the next to receive the packet.
+ *
+ *          `inline length`: The amount of services in the route, if the route
+ *                           is carried inline in the event. Otherwise, zero.
  */
 class RouteDescriptor
 {
@@ -36,11 +52,12 @@ public:
      */
     explicit RouteDescriptor()
     {
-        m_Src                 = static_cast<uint64_t>(-1);
-        m_Dest                = static_cast<uint64_t>(-1);
-        m_PreviousService     = static_cast<uint64_t>(-1);
+        m_Src                 = static_cast<uint32_t>(-1);
+        m_Dest                = static_cast<uint32_t>(-1);
+        m_PreviousService     = static_cast<uint32_t>(-1);
         m_Offset              = 0;
         m_ForwardingDirection = true;
+        m_InlineLength        = 0;
     }
 
     /**
@@ -60,8 +77,11 @@ public:
                              const uint64_t    previousService,
                              const std::size_t offset,
                              const bool        forwardingDirection)
-        : m_Src(src), m_Dest(dest), m_PreviousService(previousService),
-          m_Offset(offset), m_ForwardingDirection(forwardingDirection)
+        : m_Src(static_cast<uint32_t>(src)),
+          m_Dest(static_cast<uint32_t>(dest)),
+          m_PreviousService(static_cast<uint32_t>(previousService)),
+          m_Offset(static_cast<uint16_t>(offset)),
+          m_ForwardingDirection(forwardingDirection), m_InlineLength(0U)
     {}
 
     /**
@@ -121,16 +141,33 @@ public:
         return m_ForwardingDirection;
     }
 
+    /**
+     * @brief Returns the amount of services in the route, if the route is
+     *        carried inline in the event. Otherwise, returns zero.
+     *
+     * @return the amount of services in the route carried inline
+     */
+    ENGINE_INLINE std::size_t getInlineLength() const
+    {
+        return m_InlineLength;
+    }
+
 private:
+    friend class SourceRoutedEvent;
+
     /**
      * @brief The route source service's identifier.
+     *
+     * @details
+     *        The services' identifiers are stored in 32 bits, as in the
+     *        routes, to keep the events compact.
      */
-    uint64_t m_Src;
+    uint32_t m_Src;
 
     /**
      * @brief The route destination service's identifier.
      */
-    uint64_t m_Dest;
+    uint32_t m_Dest;
 
     /**
      * @brief The previous service that has forwarded this descriptor.
@@ -151,7 +188,7 @@ private:
      *        be `m2`. With that, the link will know which direction to
      *        forward the packet.
      */
-    uint64_t m_PreviousService;
+    uint32_t m_PreviousService;
 
     /**
      * @brief The route offset.
@@ -173,8 +210,11 @@ private:
      *        destination service, respectively. For more information
      *        in how the route is represented, look at the documentation
      *        provided by the `Route` and `RoutingTable` classes.
+     *
+     *        The offset is stored in 16 bits, therefore, the routes are
+     *        limited to `RouteMaxLength` services.
      */
-    std::size_t m_Offset;
+    uint16_t m_Offset;
 
     /**
      * @brief The route forward direction.
@@ -189,6 +229,85 @@ private:
      *       from the slave to the master.
      */
     bool m_ForwardingDirection;
+
+    /**
+     * @brief The amount of services in the route carried inline.
+     *
+     * @details
+     *        It is stored in the padding of the route descriptor, therefore,
+     *        it does not increase the event's size. It is set by the
+     *        `SourceRoutedEvent`, which carries the route's path.
+     */
+    uint8_t m_InlineLength;
+};
+
+/**
+ * @brief A route is used to indicate the services in a path that must be
+ *        passed through for arrive at a specified destination service
+ *        starting from a specified source service.
+ *
+ * @details
+ *        Although, in a route from a source service to a destination services
+ *        may be necessary to pass through many masters, machines and links.
+ *        It is only necessary to store the links' identifiers inside the route,
+ *        since the link is a graph edge and, therefore, it is only connected to
+ *        two services and, then the link already know which is the next service
+ *        in the route.
+ *
+ *        Furthermore, it is not stored inside the route the source service and
+ *        the destination service by the same reason give above.
+ *
+ *        Example:
+ *
+ *          M1 -> l1 -> m1 -> l2 -> m2 -> l3 -> M2 -> l4 -> m3 -> l5 -> m4
+ *
+ *          A route starting from M1 and arriving at m4 is:
+ *          (l1, l2, l3, l4, l5)
+ *
+ *        The route is a read-only view (span) of the path, whose elements are
+ *        stored by the route provider. Therefore, it is cheap to be copied and
+ *        it remains valid as long as the route provider keeps the path (see
+ *        `RouteProvider`).
+ */
+class Route
+{
+public:
+    /**
+     * @brief Constructor which specifies the route's length and
+     *        the route's path.
+     *
+     * @param length the route's length
+     * @param path the route's path, that is composed by the
+     *             services' identifiers that are inner to this path
+     *             (i.e., it is neither the source nor the vertex service)
+     */
+    explicit Route(const std::size_t length, const std::uint32_t *path) noexcept
+        : m_Length(length), m_Path(path)
+    {}
+
+    /**
+     * @brief Returns the path's length.
+     *
+     * @return the path's length
+     */
+    ENGINE_INLINE std::size_t getLength() const
+    {
+        return m_Length;
+    }
+
+    /**
+     * @brief Returns the service's identifier of the n-th path element.
+     *
+     * @return the service's identifier of the n-th path element.
+     */
+    ENGINE_INLINE std::uint32_t operator[](std::size_t n) const
+    {
+        return m_Path[n];
+    }
+
+private:
+    std::size_t          m_Length;
+    const std::uint32_t *m_Path;
 };
 
 #endif // ENGINE_ROUTING_ROUTE_HPP
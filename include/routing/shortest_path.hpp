@@ -0,0 +1,123 @@
+#ifndef ENGINE_ROUTING_SHORTEST_PATH_HPP
+#define ENGINE_ROUTING_SHORTEST_PATH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <routing/provider.hpp>
+#include <simulator/service_table.hpp>
+#include <vector>
+
+/**
+ * @brief A shortest path route provider computes the routes on demand from
+ *        the links that have been registered in the service table.
+ *
+ * @details
+ *        The services and the links registered in the service table compose
+ *        an undirected graph, in which each link is an edge between its two
+ *        endpoints. The route between two services is computed on its first
+ *        request through the Dijkstra's algorithm, which stops as soon as the
+ *        destination is reached. Only the machines and the switches forward
+ *        the packets and, therefore, the other services may only be the
+ *        endpoints of a route. The ties are broken by the smallest services'
+ *        identifiers, such that, the routes are deterministic.
+ *
+ *        The computed routes are cached in a bounded, direct-mapped cache
+ *        that is private to each thread, such that, there is no
+ *        synchronization between the threads and the memory used does not
+ *        grow with the amount of routes requested.
+ *
+ *        Therefore, there is no need to generate and to load a routing file
+ *        that has a route for every pair of communicating services.
+ */
+class ShortestPathRouteProvider final : public RouteProvider
+{
+public:
+    /**
+     * @brief The default amount of routes cached by each thread.
+     */
+    static constexpr std::size_t DefaultCacheCapacity = 4096U;
+
+    /**
+     * @brief Constructs the provider from the links that have been registered
+     *        in the specified service table.
+     *
+     * @details
+     *        The links registered after the construction are not taken into
+     *        account.
+     *
+     * @param services the service table
+     * @param metric the metric that is minimized by the routes
+     * @param cacheCapacity the amount of routes cached by each thread, which
+     *                      is rounded up to a power of two
+     */
+    explicit ShortestPathRouteProvider(
+        const ispd::sim::ServiceTable &services,
+        RouteMetric                    metric        = RouteMetric::HOPS,
+        std::size_t                    cacheCapacity = DefaultCacheCapacity);
+
+    /**
+     * @brief Returns the shortest route between the specified source and
+     *        destination services.
+     *
+     *        However, if the destination is not reachable from the source,
+     *        then the program is immediately aborted.
+     *
+     * @return the shortest route between the specified source and
+     *         destination services
+     */
+    Route getRoute(uint32_t src, uint32_t dest) const override;
+
+private:
+    /**
+     * @brief An edge of the services' graph, which is a link from one
+     *        service to a neighbor service.
+     */
+    struct Edge
+    {
+        uint32_t m_Neighbor;
+        uint32_t m_Link;
+        double   m_Weight;
+    };
+
+    /**
+     * @brief Computes the shortest route between the specified source and
+     *        destination services.
+     *
+     * @param path the vector that receives the route's path
+     */
+    void computeRoute(uint32_t               src,
+                      uint32_t               dest,
+                      std::vector<uint32_t> &path) const;
+
+    /**
+     * @brief The offsets of each service's edges. The edges of the i-th
+     *        service are in the range [m_Offsets[i], m_Offsets[i + 1]).
+     */
+    std::vector<uint64_t> m_Offsets;
+
+    /**
+     * @brief The edges, sorted by the neighbors' identifiers within each
+     *        service.
+     */
+    std::vector<Edge> m_Edges;
+
+    /**
+     * @brief It indicates, for each service, if the service forwards the
+     *        packets that are not destined to itself.
+     */
+    std::vector<bool> m_Forwards;
+
+    /**
+     * @brief The amount of routes cached by each thread, which is a power of
+     *        two.
+     */
+    std::size_t m_CacheCapacity;
+
+    /**
+     * @brief The provider's unique identifier, which is used to detect that a
+     *        thread's cache has been filled by another provider.
+     */
+    uint64_t m_Generation;
+};
+
+#endif // ENGINE_ROUTING_SHORTEST_PATH_HPP
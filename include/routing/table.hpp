@@ -1,78 +1,74 @@
 #ifndef ENGINE_ROUTING_TABLE_HPP
 #define ENGINE_ROUTING_TABLE_HPP
 
+#include <algorithm>
 #include <core/core.hpp>
 #include <cstdint>
-#include <fstream>
-#include <iostream>
+#include <functional>
 #include <math/utility.hpp>
+#include <routing/provider.hpp>
+#include <routing/route.hpp>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 /**
- * @brief A route is used to indicate the services in a path that must be
- *        passed through for arrive at a specified destination service
- *        starting from a specified source service.
+ * @brief The header of a binary routing file.
  *
  * @details
- *        Although, in a route from a source service to a destination services
- *        may be necessary to pass through many masters, machines and links.
- *        It is only necessary to store the links' identifiers inside the route,
- *        since the link is a graph edge and, therefore, it is only connected to
- *        two services and, then the link already know which is the next service
- *        in the route.
+ *        A binary routing file (version 3) is composed by the header followed
+ *        by the routing table's arrays, in the following order, each one
+ *        starting at a multiple of 8 bytes.
  *
- *        Furthermore, it is not stored inside the route the source service and
- *        the destination service by the same reason give above.
- *
- *        Example:
- *
- *          M1 -> l1 -> m1 -> l2 -> m2 -> l3 -> M2 -> l4 -> m3 -> l5 -> m4
- *
- *          A route starting from M1 and arriving at m4 is:
- *          (l1, l2, l3, l4, l5)
+ *          `sources`: uint32_t[source count]
+ *          `source offsets`: uint64_t[source count + 1]
+ *          `destinations`: uint32_t[route count]
+ *          `alternative offsets`: uint64_t[route count + 1]
+ *          `path starts`: uint64_t[alternative count]
+ *          `path lengths`: uint32_t[alternative count]
+ *          `paths`: uint32_t[path count]
  *
+ *        The integers are stored in the byte order of the machine that has
+ *        written the file, which is checked through the byte order mark.
  */
-class Route
+struct RoutingFileHeader
 {
-public:
-    /**
-     * @brief Constructor which specifies the route's length and
-     *        the route's path.
-     *
-     * @param length the route's length
-     * @param path the route's path, that is composed by the
-     *             services' identifiers that are inner to this path
-     *             (i.e., it is neither the source nor the vertex service)
-     */
-    explicit Route(std::size_t length, std::uint32_t *path) noexcept
-        : m_Length(length), m_Path(path)
-    {}
+    char     m_Magic[8];
+    uint32_t m_Version;
+    uint32_t m_ByteOrderMark;
+    uint64_t m_SourceCount;
+    uint64_t m_RouteCount;
+    uint64_t m_AlternativeCount;
+    uint64_t m_PathCount;
+    uint64_t m_FileSize;
+};
 
-    /**
-     * @brief Returns the path's length.
-     *
-     * @return the path's length
-     */
-    ENGINE_INLINE std::size_t getLength() const
-    {
-        return m_Length;
-    }
+/**
+ * @brief The binary routing file's magic number.
+ */
+constexpr char RoutingFileMagic[8] = {'I', 'S', 'P', 'D', 'R', 'O', 'U', 'T'};
 
-    /**
-     * @brief Returns the service's identifier of the n-th path element.
-     *
-     * @return the service's identifier of the n-th path element.
-     */
-    ENGINE_INLINE std::uint32_t operator[](std::size_t n) const
-    {
-        return m_Path[n];
-    }
+/**
+ * @brief The binary routing file's current version.
+ */
+constexpr uint32_t RoutingFileVersion = 3U;
 
-private:
-    std::size_t    m_Length;
-    std::uint32_t *m_Path;
-};
+/**
+ * @brief The binary routing file's byte order mark.
+ */
+constexpr uint32_t RoutingFileByteOrderMark = 0x01020304U;
+
+/**
+ * @brief A route filter decides which routes are loaded in a routing table.
+ *
+ * @details
+ *        It is called with the route's source and destination services and
+ *        with the elements of all the route's alternatives, and it returns
+ *        true if the route must be kept. Every alternative of a route is
+ *        either kept or discarded, such that, the alternative selected for a
+ *        flow does not depend on the filter.
+ */
+using RouteFilter = std::function<bool(
+    uint32_t src, uint32_t dest, const uint32_t *elements, std::size_t count)>;
 
 /**
  * @brief A routing table is used to store the shortest route between
@@ -80,16 +76,12 @@ private:
  *
  * @details
  *        Mathematically speaking, our route definition is a triple (u, v, p)
- *        in which `u` is the source service, `v` is the destination service and
- * `p` is the path between these two services.
- *
- *        Our routing table is basically a hash table that maps the (u, v) pair
- *        to the path p, that is, it maps (u, v) -> p. Therefore, the route
- * itself that is represented by `p` do not need to contains the `u` and `v`
- * services.
+ *        in which `u` is the source service, `v` is the destination service
+ *        and `p` is the path between these two services.
  *
- *        Hence, it is by these reasons that the path do not contains the source
- * and destination services.
+ *        Our routing table maps the (u, v) pair to the path p, that is, it
+ *        maps (u, v) -> p. Therefore, the route itself that is represented by
+ *        `p` do not need to contains the `u` and `v` services.
  *
  *        For instance, suppose the following topology.
  *
@@ -101,39 +93,159 @@ private:
  *          (M1, m3, [L1, L2, L3])
  *
  *        Note that is only necessary to store the link service type in the
- * route.
+ *        route.
+ *
+ *        The table is frozen (read-only) and it is stored in the compressed
+ *        sparse row (CSR) layout, that is,
+ *
+ *          `sources`: the sorted sources' identifiers;
+ *
+ *          `source offsets`: the range of each source in the destinations;
+ *
+ *          `destinations`: the sorted destinations' identifiers of each
+ *                          source;
+ *
+ *          `alternative offsets`: the range of each route in the
+ *                                 alternatives;
+ *
+ *          `path starts` and `path lengths`: the range of each alternative
+ *                                            in the path pool;
+ *
+ *          `paths`: the contiguous pool with the routes' paths.
+ *
+ *        Therefore, a route lookup is two binary searches over contiguous
+ *        arrays, and there is no allocation per route. The routing table is
+ *        constructed by the `RoutingTableBuilder`.
+ *
+ *        Each route has one or more equal-cost alternatives (ECMP), that is,
+ *        paths between the same source and destination services. The packets
+ *        of a flow, such as the packets that carry the same task, always take
+ *        the alternative that is selected by a hash of the flow's identifier.
+ *        Since the selection does not depend on any state, it is the same on
+ *        every service that forwards the packets, and it is the same when
+ *        the events are reprocessed after a rollback. Hence, the flows
+ *        between two services are spread among the alternatives, and so are
+ *        the services that forward them.
+ *
+ *        The routes of the same source share their common prefixes in the
+ *        path pool, that is, a route whose path is a prefix of another
+ *        route's path is stored as the beginning of that path. For instance,
+ *        in the linear topology above, the routes from M1 are
+ *
+ *          (M1, m1, [L1]), (M1, m2, [L1, L2]), ..., (M1, m4, [L1, ..., L4])
+ *
+ *        and all of them are ranges of the single stored path [L1, ..., L4].
+ *        Hence, the path pool stores only the paths to the leaves of each
+ *        source's route trie, instead of every path in full, while each
+ *        route is still a contiguous range with constant-time indexing.
+ *
+ *        The arrays are stored in a single image, which is exactly the
+ *        content of a binary routing file (see `RoutingFileHeader`). Hence,
+ *        a binary routing file is used in place through `mmap`, with no
+ *        parsing, and it is shared in the page cache by every process that
+ *        maps it.
  */
-class RoutingTable
+class RoutingTable final : public RouteProvider
 {
 public:
+    RoutingTable(const RoutingTable &)            = delete;
+    RoutingTable &operator=(const RoutingTable &) = delete;
+
+    ~RoutingTable();
+
     /**
-     * @brief Add a route in the table.
+     * @brief Maps a binary routing file and uses it in place as a routing
+     *        table.
      *
-     *        If a route has already been defined to the specified source and
-     *        destination services, then the current call to adding a route
-     *        will replace the old route by the current specified route.
+     *        If the file could not be mapped or it is not a valid binary
+     *        routing file, then the program is immediately aborted.
+     *
+     * @param filepath the binary routing file's path
+     *
+     * @return the routing table
+     */
+    static RoutingTable *map(const std::string &filepath);
+
+    /**
+     * @brief Writes the routing table as a binary routing file.
+     *
+     *        If the file could not be written, then the program is
+     *        immediately aborted.
+     *
+     * @param filepath the binary routing file's path
+     */
+    void write(const std::string &filepath) const;
+
+    /**
+     * @brief Returns a new routing table with the routes of this routing
+     *        table that are kept by the specified filter.
+     *
+     * @param filter the route filter
+     *
+     * @return the new routing table
+     */
+    RoutingTable *filter(const RouteFilter &filter) const;
+
+    /**
+     * @brief Returns the registered route between the specified source and
+     *        destination services.
+     *
+     *        However, if no route has previously been defined to these
+     *        services, then the program is immediately aborted.
+     *
+     * @return the registered route between the specified source and
+     *         destination services
      */
     ENGINE_INLINE
-    void addRoute(const uint32_t src, const uint32_t dest, const Route *route)
+    Route getRoute(const uint32_t src, const uint32_t dest) const override
     {
-        m_RoutingTable.insert(std::make_pair(szudzik(src, dest), route));
+        return getAlternative(m_AlternativeOffsets[findRoute(src, dest)]);
     }
 
     /**
-     * @brief Returns the registered route between the specified source and
-     *        destination services.
+     * @brief Returns the registered route's alternative between the specified
+     *        source and destination services that is selected by the
+     *        specified flow.
      *
      *        However, if no route has previously been defined to these
-     *        services, then `nullptr` is returned.
+     *        services, then the program is immediately aborted.
      *
-     * @return the registered route between the specified source and destination
-     *         services; however, if no route has previously been defined to
-     *         these services, then `nullptr` is returned.
+     * @return the registered route's alternative that is selected by the
+     *         specified flow
      */
     ENGINE_INLINE
-    const Route *getRoute(const uint32_t src, const uint32_t dest) const
+    Route getRoute(const uint32_t src,
+                   const uint32_t dest,
+                   const uint64_t flow) const override
     {
-        return m_RoutingTable.at(szudzik(src, dest));
+        const std::size_t r     = findRoute(src, dest);
+        const uint64_t    first = m_AlternativeOffsets[r];
+        const uint64_t    count = m_AlternativeOffsets[r + 1] - first;
+
+        // The hash is only computed if there is more than one alternative,
+        // since the most routes have a single one.
+        if (count == 1ULL)
+            return getAlternative(first);
+
+        return getAlternative(first + mix64(flow) % count);
+    }
+
+    using RouteProvider::getHop;
+    using RouteProvider::getLength;
+
+    std::size_t getLength(const uint32_t src,
+                          const uint32_t dest,
+                          const uint64_t flow) const override
+    {
+        return getRoute(src, dest, flow).getLength();
+    }
+
+    uint32_t getHop(const uint32_t    src,
+                    const uint32_t    dest,
+                    const std::size_t offset,
+                    const uint64_t    flow) const override
+    {
+        return getRoute(src, dest, flow)[offset];
     }
 
     /**
@@ -144,140 +256,330 @@ public:
     ENGINE_INLINE
     std::size_t getRoutesSize() const
     {
-        return m_RoutingTable.size();
+        return m_RouteCount;
+    }
+
+    /**
+     * @brief Returns the amount of elements stored in the path pool, which
+     *        are shared by the routes with common prefixes.
+     *
+     * @return the amount of elements stored in the path pool
+     */
+    ENGINE_INLINE
+    std::size_t getPathsSize() const
+    {
+        return m_PathCount;
+    }
+
+    /**
+     * @brief Returns the amount of alternatives of all routes.
+     *
+     * @return the amount of alternatives of all routes
+     */
+    ENGINE_INLINE
+    std::size_t getAlternativesSize() const
+    {
+        return m_AlternativeCount;
     }
 
 private:
+    friend class RoutingTableBuilder;
+
+    RoutingTable() = default;
+
+    /**
+     * @brief Returns the index of the route between the specified source and
+     *        destination services.
+     *
+     *        However, if no route has previously been defined to these
+     *        services, then the program is immediately aborted.
+     */
+    ENGINE_INLINE
+    std::size_t findRoute(const uint32_t src, const uint32_t dest) const
+    {
+        const uint32_t *sourcesEnd = m_Sources + m_SourceCount;
+        const uint32_t *source = std::lower_bound(m_Sources, sourcesEnd, src);
+
+        if (UNLIKELY(source == sourcesEnd || *source != src))
+            die("No route from %u to %u has been defined.", src, dest);
+
+        const std::size_t i     = source - m_Sources;
+        const uint32_t   *first = m_Destinations + m_SourceOffsets[i];
+        const uint32_t   *last  = m_Destinations + m_SourceOffsets[i + 1];
+        const uint32_t   *destination = std::lower_bound(first, last, dest);
+
+        if (UNLIKELY(destination == last || *destination != dest))
+            die("No route from %u to %u has been defined.", src, dest);
+
+        return destination - m_Destinations;
+    }
+
+    /**
+     * @brief Returns the path of the specified alternative.
+     */
+    ENGINE_INLINE Route getAlternative(const uint64_t a) const
+    {
+        return Route(m_PathLengths[a], m_Paths + m_PathStarts[a]);
+    }
+
+    /**
+     * @brief Returns the size (in bytes) of the image of a routing table with
+     *        the specified amount of sources, routes, alternatives and path
+     *        elements.
+     *
+     * @param offsets if not null, it receives the offsets (in bytes) of the
+     *                image's arrays
+     */
+    static std::size_t imageSize(uint64_t  sourceCount,
+                                 uint64_t  routeCount,
+                                 uint64_t  alternativeCount,
+                                 uint64_t  pathCount,
+                                 uint64_t *offsets = nullptr);
+
+    /**
+     * @brief Points the routing table's arrays to the specified image.
+     *
+     * @details
+     *        It is the caller's responsibility to ensure that the image has
+     *        been validated.
+     */
+    void attach(const unsigned char *image);
+
+    /**
+     * @brief The image, if it is owned by the routing table. Otherwise, if
+     *        the image is mapped from a file, it is empty.
+     */
+    std::vector<uint64_t> m_Storage;
+
+    /**
+     * @brief The mapped image, if it is mapped from a file.
+     */
+    void       *m_Mapping     = nullptr;
+    std::size_t m_MappingSize = 0;
+
+    /**
+     * @brief The image, which starts with the binary routing file's header.
+     */
+    const unsigned char *m_Image = nullptr;
+
     /**
-     * @brief An unordered map representing the routing table that stores a
-     *        pair containing a 64-bit unsigned integer that represents the
-     *        resulting value from the Szudzik's pairing function applied to
-     *        the source and destination service's identifier, and containing
-     *        the route between these source and destination services.
+     * @brief The sorted sources' identifiers.
      */
-    std::unordered_map<uint64_t, const Route *> m_RoutingTable;
+    const uint32_t *m_Sources     = nullptr;
+    uint64_t        m_SourceCount = 0;
+
+    /**
+     * @brief The offsets of each source's destinations. The destinations of
+     *        the i-th source are in the range [m_SourceOffsets[i],
+     *        m_SourceOffsets[i + 1]).
+     */
+    const uint64_t *m_SourceOffsets = nullptr;
+
+    /**
+     * @brief The destinations' identifiers, sorted within each source.
+     */
+    const uint32_t *m_Destinations = nullptr;
+    uint64_t        m_RouteCount   = 0;
+
+    /**
+     * @brief The offsets of each route's alternatives. The alternatives of
+     *        the r-th route are in the range [m_AlternativeOffsets[r],
+     *        m_AlternativeOffsets[r + 1]), which is never empty.
+     */
+    const uint64_t *m_AlternativeOffsets = nullptr;
+    uint64_t        m_AlternativeCount   = 0;
+
+    /**
+     * @brief The start and the length of each alternative's path. The path
+     *        of the a-th alternative is in the range [m_PathStarts[a],
+     *        m_PathStarts[a] + m_PathLengths[a]), which may overlap other
+     *        alternatives' ranges.
+     */
+    const uint64_t *m_PathStarts  = nullptr;
+    const uint32_t *m_PathLengths = nullptr;
+
+    /**
+     * @brief The contiguous pool with the routes' paths.
+     */
+    const uint32_t *m_Paths     = nullptr;
+    uint64_t        m_PathCount = 0;
 };
 
-class RoutingTableReader
+/**
+ * @brief A routing table builder collects the routes and freezes them into a
+ *        routing table.
+ */
+class RoutingTableBuilder
 {
 public:
     /**
-     * @brief Reads a file in the `.route` format containing the routes between
-     *        two services and construct the routing table with that read
-     * information.
+     * @brief Add a route in the table.
+     *
+     *        If a route has already been defined to the specified source and
+     *        destination services, then the current call to adding a route
+     *        will replace the old route by the current specified route.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     * @param length the route's length
+     * @param path the route's path
      */
-    RoutingTable *read(const std::string &filepath)
+    void addRoute(const uint32_t    src,
+                  const uint32_t    dest,
+                  const std::size_t length,
+                  const uint32_t   *path)
     {
-        std::ifstream file(filepath);
-
-        // It checks if the file could not be opened for some reason. If so,
-        // then the program is immediately aborted.
-        if (!file.is_open())
-            die("Routing file '%s' could not be opened", filepath.c_str());
-
-        RoutingTable *rt = new RoutingTable();
-
-        // Read the file. Each line in the file contains a route indicating
-        // the source service, the destination service and the services'
-        // identifiers that composes the inner route's element.
-        for (std::string routeLine; std::getline(file, routeLine);) {
-            uint32_t src;
-            uint32_t dest;
-            Route   *route = readRoute(routeLine, src, dest);
-            rt->addRoute(src, dest, route);
+        m_Entries.push_back(Entry{src, dest, m_Paths.size(), length, false});
+        m_Paths.insert(m_Paths.end(), path, path + length);
+    }
+
+    /**
+     * @brief Add an equal-cost alternative to the route between the specified
+     *        source and destination services.
+     *
+     *        If no route has been defined to the specified source and
+     *        destination services, then the alternative is the route's first
+     *        one, as if the route had been added.
+     *
+     * @param src the source service's identifier
+     * @param dest the destination service's identifier
+     * @param length the alternative's length
+     * @param path the alternative's path
+     */
+    void addEqualCostPath(const uint32_t    src,
+                          const uint32_t    dest,
+                          const std::size_t length,
+                          const uint32_t   *path)
+    {
+        m_Entries.push_back(Entry{src, dest, m_Paths.size(), length, true});
+        m_Paths.insert(m_Paths.end(), path, path + length);
+    }
+
+    /**
+     * @brief Add the routes of another builder.
+     *
+     *        The routes are added after the routes of this builder, as if
+     *        they had been added one by one.
+     *
+     * @param other the builder whose routes will be added
+     */
+    void addRoutes(const RoutingTableBuilder &other)
+    {
+        const std::size_t pathStart = m_Paths.size();
+
+        for (Entry entry : other.m_Entries) {
+            entry.m_PathStart += pathStart;
+            m_Entries.push_back(entry);
         }
 
-        file.close();
-        return rt;
+        m_Paths.insert(
+            m_Paths.end(), other.m_Paths.begin(), other.m_Paths.end());
     }
 
-private:
     /**
-     * @brief A parsing stage is an enumeration that is used
-     *        classify the current parsing stage of the routing
-     *        table reader.
+     * @brief Freeze the added routes into a routing table.
+     *
+     * @details
+     *        The alternatives of each source are inserted in a trie, whose
+     *        leaves' paths are copied to the path pool. Then, each alternative
+     *        is the range of the pool with the path of any leaf that descends
+     *        from it.
+     *
+     * @return the routing table
      */
-    enum ParsingStage
+    RoutingTable *build();
+
+private:
+    struct Entry
     {
-        /**
-         * @brief This parsing stage indicates that the source service
-         *        identifier is being parsed by the reader.
-         */
-        SOURCE_VERTEX,
+        uint32_t    m_Source;
+        uint32_t    m_Destination;
+        std::size_t m_PathStart;
+        std::size_t m_PathLength;
 
         /**
-         * @brief This parsing stage indicates that the destination service
-         *        identifier is being parsed by the reader.
+         * @brief It indicates if the entry is an alternative that is added to
+         *        the route instead of replacing it.
          */
-        DESTINATION_VERTEX,
+        bool m_IsAlternative;
+    };
+
+    /**
+     * @brief A node of a source's route trie.
+     */
+    struct TrieNode
+    {
+        uint32_t m_Parent;
+        uint32_t m_Element;
+        uint32_t m_Depth;
+        bool     m_IsLeaf;
 
         /**
-         * @brief This parsing stage indicates that the route service
-         *        identifier is being parsed by the reader.
+         * @brief The start of the node's path in the path pool.
          */
-        INNER_VERTEX
+        uint64_t m_Start;
     };
 
-    Route *readRoute(const std::string &routeLine,
-                     uint32_t          &src,
-                     uint32_t          &dest)
-    {
-        const std::size_t routeLineLength = routeLine.length();
-        std::size_t       whitespaceCount = 0;
-
-        std::size_t    pathLength = 0;
-        std::size_t    pathIndex  = 0;
-        std::uint32_t *path       = nullptr;
-
-        // It counts the amount of whitespaces the route line contains.
-        // With that information in hands, it is possible to conclude the
-        // path length and allocate the exactly amount of path elements.
-        for (std::size_t i = 0; i < routeLineLength; i++)
-            if (routeLine[i] == ' ')
-                whitespaceCount++;
-
-        // It sets the path length and allocate the path elements.
-        pathLength = whitespaceCount - 1;
-        path       = new std::uint32_t[pathLength];
-
-        std::size_t  partStart  = 0;
-        std::size_t  partLength = 0;
-        ParsingStage stage      = ParsingStage::SOURCE_VERTEX;
-
-        for (std::size_t i = 0; i < routeLineLength; i++) {
-            while (routeLine[i] != ' ' && i < routeLineLength) {
-                partLength++;
-                i++;
-            }
-
-            // It obtains a route part. That is represented by a sequence of
-            // letters followed by a space, new line or end of file.
-            const std::string routePart =
-                routeLine.substr(partStart, partLength);
-
-            switch (stage) {
-            case ParsingStage::SOURCE_VERTEX:
-                src   = std::stoul(routePart);
-                stage = ParsingStage::DESTINATION_VERTEX;
-                break;
-            case ParsingStage::DESTINATION_VERTEX:
-                dest  = std::stoul(routePart);
-                stage = ParsingStage::INNER_VERTEX;
-                break;
-            case ParsingStage::INNER_VERTEX:
-                path[pathIndex++] = std::stoul(routePart);
-                break;
-            default:
-                std::cerr << "Unknown parsing stage." << std::endl;
-                exit(EXIT_FAILURE);
-            }
-
-            partStart  = i + 1;
-            partLength = 0;
-        }
+    std::vector<Entry>    m_Entries;
+    std::vector<uint32_t> m_Paths;
+};
 
-        return new Route(pathLength, path);
-    }
+/**
+ * @brief A routing table reader reads a routing file and constructs the
+ *        routing table with the routes read.
+ *
+ * @details
+ *        A routing file in the text `.route` format has one route per line,
+ *        containing the source service's identifier, the destination service's
+ *        identifier and the services' identifiers that compose the route's
+ *        inner elements, separated by whitespaces. The equal-cost
+ *        alternatives of a route are separated by a vertical bar.
+ *
+ *          src dest hop hop ...
+ *          src dest hop hop ... | hop hop ... | ...
+ *
+ *        The file is mapped and split in chunks at line boundaries, which are
+ *        parsed in parallel directly over the mapped buffer, with no
+ *        allocation per route or per identifier.
+ */
+class RoutingTableReader
+{
+public:
+    /**
+     * @brief Reads a file in the `.route` format containing the routes between
+     *        two services and construct the routing table with that read
+     *        information.
+     *
+     *        If the file is a binary routing file, then it is mapped and used
+     *        in place instead.
+     *
+     * @param filepath the routing file's path
+     * @param threads the amount of threads used to parse the file; if zero,
+     *                the amount of hardware threads is used
+     *
+     * @return the routing table
+     */
+    RoutingTable *read(const std::string &filepath, unsigned threads = 0U);
+
+    /**
+     * @brief Reads a routing file, keeping only the routes that are kept by
+     *        the specified filter.
+     *
+     *        The routes are filtered while they are parsed, therefore, the
+     *        discarded routes are never stored. If the file is a binary
+     *        routing file, then the kept routes are copied from the mapped
+     *        file, which is released afterwards.
+     *
+     * @param filepath the routing file's path
+     * @param filter the route filter
+     * @param threads the amount of threads used to parse the file; if zero,
+     *                the amount of hardware threads is used
+     *
+     * @return the routing table
+     */
+    RoutingTable *read(const std::string &filepath,
+                       const RouteFilter &filter,
+                       unsigned           threads = 0U);
 };
 
 #endif // ENGINE_ROUTING_TABLE_HPP
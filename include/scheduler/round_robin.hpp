@@ -52,6 +52,23 @@ public:
                          const sid_t  slaveId,
                          const Task  &task) override;
 
+    /// \brief Reverses the initialization phase of the scheduler.
+    ///
+    /// \param tasks The amount of tasks scheduled by the initialization.
+    void onInitReverse(const int tasks) override;
+
+    /// \brief Reverses the handling of a completed task.
+    ///
+    /// \param now The time at which the task has been completed.
+    /// \param slaveId The identifier of the slave resource that completed the
+    ///                task.
+    /// \param task The completed task.
+    /// \param tasks The amount of tasks scheduled by the handling.
+    void onCompletedTaskReverse(const double now,
+                                const sid_t  slaveId,
+                                const Task  &task,
+                                const int    tasks) override;
+
     /// \brief Adds a resource to the circular queue.
     ///
     /// \param resource The resource to be added to the circular queue.
@@ -96,6 +113,16 @@ public:
         return resource;
     }
 
+    /// \brief Reverses the last resource scheduling.
+    ///
+    /// The index of the next resource to be scheduled is moved one position
+    /// back, maintaining the circular queue property.
+    void scheduleReverse() override
+    {
+        m_NextResource = (m_NextResource + m_Resources.size() - 1) %
+                         m_Resources.size();
+    }
+
 private:
     /// \brief A vector containing the resources to be scheduled in a
     ///        round-robin manner.
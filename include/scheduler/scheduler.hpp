@@ -78,6 +78,38 @@ public:
     /// workload, or priority.
     virtual uint64_t schedule() = 0;
 
+    /// \brief Reverses the initialization of the scheduler.
+    ///
+    /// \param tasks The amount of tasks that have been taken from the
+    ///              workload by the reversed initialization.
+    ///
+    /// The scheduler must restore its state, and the master's workload, to
+    /// the exact state they had before `onInit` has been called. The random
+    /// numbers drawn by the workload are reversed by the engine.
+    virtual void onInitReverse(const int tasks) = 0;
+
+    /// \brief Reverses the handling of a completed task.
+    ///
+    /// \param now The time at which the task has been completed.
+    /// \param resourceId The identifier of the resource that completed the
+    ///                   task.
+    /// \param task The completed task.
+    /// \param tasks The amount of tasks that have been taken from the
+    ///              workload by the reversed handling.
+    ///
+    /// The scheduler must restore its state, and the master's workload, to
+    /// the exact state they had before `onCompletedTask` has been called.
+    virtual void onCompletedTaskReverse(const double   now,
+                                        const uint64_t resourceId,
+                                        const Task    &task,
+                                        const int      tasks) = 0;
+
+    /// \brief Reverses the last resource scheduling.
+    ///
+    /// After this function is called, the next call to `schedule` returns the
+    /// same resource that has been returned by the reversed call.
+    virtual void scheduleReverse() = 0;
+
     /// \brief Sets the master for the scheduler.
     ///
     /// \param master A pointer to the master object.
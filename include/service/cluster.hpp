@@ -0,0 +1,251 @@
+#ifndef ENGINE_CLUSTER_HPP
+#define ENGINE_CLUSTER_HPP
+
+#include <allocator/rootsim_allocator.hpp>
+#include <core/core.hpp>
+#include <cstdint>
+#include <service/core_scheduler.hpp>
+#include <service/link.hpp>
+#include <service/machine.hpp>
+#include <service/service.hpp>
+
+/**
+ * @brief The greatest amount of machines of a cluster, which is limited by
+ *        the machine's index that is carried by the tasks.
+ */
+static constexpr uint32_t ClusterMaxMachines = UINT16_MAX + 1U;
+
+/**
+ * @brief Returns the identifier with which a master schedules the specified
+ *        machine of the specified cluster as one of its slaves.
+ *
+ * @details
+ *        The services' identifiers are stored in 32 bits, therefore, the
+ *        machine's index is stored in the upper 32 bits of the slave's
+ *        identifier. The first machine's slave identifier is the cluster's
+ *        own identifier, and the slave identifier of any other service is
+ *        the service's identifier.
+ *
+ * @param clusterId the cluster's identifier
+ * @param member the machine's index within the cluster
+ */
+ENGINE_INLINE constexpr sid_t makeClusterSlaveId(const sid_t    clusterId,
+                                                 const uint32_t member)
+{
+    return clusterId | static_cast<sid_t>(member) << 32U;
+}
+
+/**
+ * @brief Returns the identifier of the service to which the tasks scheduled
+ *        to the specified slave must be sent.
+ */
+ENGINE_INLINE constexpr sid_t getSlaveServiceId(const sid_t slaveId)
+{
+    return slaveId & UINT32_MAX;
+}
+
+/**
+ * @brief Returns the machine's index, within the cluster, of the specified
+ *        slave, or zero if the slave is not a cluster's machine.
+ */
+ENGINE_INLINE constexpr uint16_t getSlaveMember(const sid_t slaveId)
+{
+    return static_cast<uint16_t>(slaveId >> 32U);
+}
+
+/**
+ * @brief A cluster represents many identical machines, each one connected to
+ *        the cluster's entry by its own access link, in a single service.
+ *
+ * @details
+ *        The racks of the modeled systems contain thousands of identical
+ *        machines. If each machine and each access link is a service, then
+ *        each one is a logical process, and each task exchanges four events
+ *        among them. The cluster keeps the state of all its machines and
+ *        access links in compact arrays, such that, the amount of logical
+ *        processes and of events exchanged among them is reduced by orders
+ *        of magnitude.
+ *
+ *        The cluster is connected to the rest of the model through ordinary
+ *        links. A task sent to a cluster carries the index of the machine
+ *        that has been scheduled (see `Task::getMember`), and the masters
+ *        address each machine as a slave (see `makeClusterSlaveId` and
+ *        `Master::addClusterSlaves`).
+ *
+ *        Upon the arrival of a task, it is communicated by the machine's
+ *        access link and, then, processed by the machine's core that becomes
+ *        free the earliest. The processed task is sent back to the cluster
+ *        itself at its departure time, when it is communicated back by the
+ *        same access link and sent back to the service from which the task
+ *        has arrived. Each access link is a half-duplex `Link`, and each
+ *        machine is the same as the `Machine`. Therefore, a cluster that is
+ *        connected through links that take no time models exactly the same
+ *        as its machines and half-duplex access links registered one by one.
+ *
+ *        The clusters do not forward packets.
+ */
+class Cluster final : public Service
+{
+public:
+    /**
+     * @param id the cluster's identifier
+     * @param machines the amount of machines
+     * @param power each machine's power in megaflops
+     * @param loadFactor each machine's load factor
+     * @param cores each machine's amount of cores
+     * @param bandwidth each access link's bandwidth in megabits
+     * @param linkLoadFactor each access link's load factor
+     * @param latency each access link's latency in seconds
+     */
+    explicit Cluster(const sid_t    id,
+                     const uint32_t machines,
+                     const double   power,
+                     const double   loadFactor,
+                     const int      cores,
+                     const double   bandwidth,
+                     const double   linkLoadFactor,
+                     const double   latency)
+        : Service(id, ServiceKind::CLUSTER), m_Machines(machines),
+          m_Cores(cores), m_PowerPerProc(power / cores),
+          m_LoadFactor(loadFactor), m_Bandwidth(bandwidth),
+          m_LinkLoadFactor(linkLoadFactor), m_Latency(latency),
+          m_CoreFreeTimes(ROOTSimAllocator<>::allocate<timestamp_t>(
+              static_cast<std::size_t>(machines) * cores)),
+          m_LinkAvailableTimes(
+              ROOTSimAllocator<>::allocate<timestamp_t>(machines)),
+          m_MachineMetrics(
+              ROOTSimAllocator<>::allocate<MachineMetrics>(machines)),
+          m_LinkMetrics(ROOTSimAllocator<>::allocate<LinkMetrics>(machines))
+    {
+        // The allocator does not zero the memory, therefore, every core and
+        // access link is set free and every metric is reset.
+        const std::size_t coreCount =
+            static_cast<std::size_t>(machines) * cores;
+
+        for (std::size_t i = 0; i < coreCount; i++)
+            m_CoreFreeTimes[i] = 0.0;
+
+        for (uint32_t i = 0; i < machines; i++) {
+            m_LinkAvailableTimes[i] = 0.0;
+            m_MachineMetrics[i]     = MachineMetrics{};
+            m_LinkMetrics[i]        = LinkMetrics{};
+        }
+    }
+
+    /**
+     * @brief It calculates the time taken in seconds by a machine to process
+     *        a task with the specified processing size in megaflops.
+     */
+    ENGINE_INLINE double timeToProcess(const double procSize) const
+    {
+        return procSize / ((1.0 - m_LoadFactor) * m_PowerPerProc);
+    }
+
+    /**
+     * @brief It calculates the time taken in seconds by an access link to
+     *        communicate a task with the specified communication size in
+     *        megabits.
+     */
+    ENGINE_INLINE double timeToCommunicate(const double commSize) const
+    {
+        return m_Latency + commSize / ((1.0 - m_LinkLoadFactor) * m_Bandwidth);
+    }
+
+    /**
+     * @brief It processes the arrival of a task, either scheduled to one of
+     *        the cluster's machines or processed by one of them.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been received
+     */
+    void onTaskArrival(timestamp_t time, const Event *event) override;
+
+    /**
+     * @brief It reverses the processing of the arrival of a task.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been processed
+     */
+    void onTaskArrivalReverse(timestamp_t time, const Event *event) override;
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Returns the cluster's lookahead.
+     *
+     * @details
+     *        Every task is communicated by an access link before it is sent,
+     *        either to the cluster itself or back to the rest of the model.
+     *
+     * @return the access links' latency
+     */
+    timestamp_t getLookahead() const override
+    {
+        return m_Latency;
+    }
+
+    ENGINE_INLINE uint32_t getMachineCount() const
+    {
+        return m_Machines;
+    }
+
+    /**
+     * @brief Returns a const (read-only) reference to the metrics of the
+     *        specified machine.
+     */
+    ENGINE_INLINE const MachineMetrics &
+    getMachineMetrics(const uint32_t member) const
+    {
+        return m_MachineMetrics[member];
+    }
+
+    /**
+     * @brief Returns a const (read-only) reference to the metrics of the
+     *        specified machine's access link.
+     */
+    ENGINE_INLINE const LinkMetrics &
+    getLinkMetrics(const uint32_t member) const
+    {
+        return m_LinkMetrics[member];
+    }
+
+private:
+    /**
+     * @brief It communicates the task through the scheduled machine's access
+     *        link and processes it in the machine.
+     */
+    void onTaskRequest(timestamp_t time, const Event *event);
+
+    /**
+     * @brief It communicates the processed task back through the machine's
+     *        access link.
+     */
+    void onTaskCompletion(timestamp_t time, const Event *event);
+
+    uint32_t m_Machines;
+    int      m_Cores;
+    double   m_PowerPerProc;
+    double   m_LoadFactor;
+    double   m_Bandwidth;
+    double   m_LinkLoadFactor;
+    double   m_Latency;
+
+    /**
+     * @brief The time in which each core becomes free. The cores of the i-th
+     *        machine are in the range [i * cores, (i + 1) * cores).
+     */
+    timestamp_t *m_CoreFreeTimes;
+
+    /**
+     * @brief The time in which each machine's access link becomes available.
+     */
+    timestamp_t *m_LinkAvailableTimes;
+
+    MachineMetrics *m_MachineMetrics;
+    LinkMetrics    *m_LinkMetrics;
+};
+
+#endif // ENGINE_CLUSTER_HPP
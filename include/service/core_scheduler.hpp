@@ -0,0 +1,236 @@
+#ifndef ENGINE_CORE_SCHEDULER_HPP
+#define ENGINE_CORE_SCHEDULER_HPP
+
+#include <allocator/rootsim_allocator.hpp>
+#include <core/core.hpp>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief An enumeration that lists the ways in which a core scheduler may
+ *        select the core that becomes free the earliest.
+ */
+enum class CoreSelection
+{
+    /**
+     * @brief The linear scan is used by the machines with up to
+     *        `getTournamentThreshold()` cores, and the tournament tree is used
+     *        by the others.
+     */
+    AUTOMATIC,
+
+    /**
+     * @brief A scan over the cores' free times, in O(cores), which is faster
+     *        than the tree for the machines with few cores.
+     */
+    LINEAR_SCAN,
+
+    /**
+     * @brief A tournament tree, in O(1) for the selection and in O(log cores)
+     *        for the update.
+     */
+    TOURNAMENT_TREE
+};
+
+/**
+ * @brief Returns the index of the least free time, breaking the ties by the
+ *        least index.
+ *
+ * @details
+ *        The widest vector instructions supported by the processor (AVX-512,
+ *        AVX2 or none) are detected once at the program's start-up. They are
+ *        used from the amount of cores in which they beat the scalar kernel,
+ *        as measured by the core selection benchmark.
+ *
+ * @param freeTimes the cores' free times
+ * @param cores the amount of cores, which must be positive
+ */
+int findEarliestCore(const timestamp_t *freeTimes, int cores);
+
+/**
+ * @brief Returns the index of the least free time, as `findEarliestCore`,
+ *        without any vector instructions.
+ */
+int findEarliestCoreScalar(const timestamp_t *freeTimes, int cores);
+
+/**
+ * @brief Returns the index of the least free time, as `findEarliestCore`,
+ *        always through the widest vector instructions available.
+ */
+int findEarliestCoreVector(const timestamp_t *freeTimes, int cores);
+
+/**
+ * @brief Returns the name of the instruction set used by `findEarliestCore`.
+ */
+const char *getEarliestCoreKernelName();
+
+/**
+ * @brief Returns the greatest amount of cores for which the linear scan is
+ *        faster than the tournament tree with the instruction set used by
+ *        `findEarliestCore`, as measured by the core selection benchmark.
+ */
+int getTournamentThreshold();
+
+/**
+ * @brief A core scheduler keeps the time in which each core of a machine
+ *        becomes free, and selects the core that becomes free the earliest.
+ *
+ * @details
+ *        The cores are the leaves of a tournament tree, that is, an implicit
+ *        binary tree in which each inner node holds the winner (the core with
+ *        the least free time) of its two children. Therefore, the earliest
+ *        core is obtained in O(1), and updating a core's free time replays
+ *        only the matches from its leaf up to the root, in O(log cores).
+ *
+ *        The ties are broken by the least core's index, such that, the same
+ *        core is selected as by a linear scan over the free times.
+ *
+ *        Both the free times and the tree are allocated through the ROOT-Sim
+ *        allocator, that is, they live in the logical process' memory and
+ *        are checkpointed and restored along with it. The tree is a function
+ *        of the free times only, hence, restoring a core's free time through
+ *        `setFreeTime` also restores the tree, as done by the reverse
+ *        handlers.
+ *
+ *        For the machines with few cores, maintaining the tree costs more
+ *        than scanning all cores' free times. Thus, by default, the tree is
+ *        only built if the amount of cores is greater than the measured
+ *        crossover (see `getTournamentThreshold`).
+ */
+class CoreScheduler
+{
+public:
+    /**
+     * @param cores the amount of cores, which must be positive
+     * @param selection the way in which the earliest core is selected
+     */
+    explicit CoreScheduler(
+        const int           cores,
+        const CoreSelection selection = CoreSelection::AUTOMATIC)
+        : m_Cores(cores)
+    {
+        if (UNLIKELY(cores <= 0))
+            die("A machine with %d cores is not supported.", cores);
+
+        // It checks if the earliest core is selected by the linear scan. If
+        // so, only the cores' free times are allocated.
+        if (selection == CoreSelection::LINEAR_SCAN ||
+            (selection == CoreSelection::AUTOMATIC &&
+             cores <= getTournamentThreshold())) {
+            m_FreeTimes = ROOTSimAllocator<>::allocate<timestamp_t>(cores);
+
+            // Every core is free from the start.
+            for (int i = 0; i < cores; i++)
+                m_FreeTimes[i] = 0.0;
+            return;
+        }
+
+        // The amount of leaves is rounded up to a power of two. The leaves
+        // past the last core never become free and, therefore, never win.
+        while (m_LeafCount < static_cast<uint32_t>(cores))
+            m_LeafCount *= 2U;
+
+        m_FreeTimes = ROOTSimAllocator<>::allocate<timestamp_t>(m_LeafCount);
+        m_Winners   = ROOTSimAllocator<>::allocate<uint32_t>(2U * m_LeafCount);
+
+        // The allocator does not zero the memory, therefore, every leaf is
+        // set, including the cores', which are free from the start.
+        for (uint32_t i = 0; i < m_LeafCount; i++) {
+            m_FreeTimes[i] = i < static_cast<uint32_t>(cores)
+                                 ? 0.0
+                                 : std::numeric_limits<timestamp_t>::infinity();
+            m_Winners[m_LeafCount + i] = i;
+        }
+
+        for (uint32_t node = m_LeafCount - 1U; node > 0U; node--)
+            playMatch(node);
+    }
+
+    /**
+     * @brief Returns the index of the core that becomes free the earliest,
+     *        which is in the interval [0, cores - 1].
+     */
+    ENGINE_INLINE int getEarliestCore() const
+    {
+        if (!m_Winners)
+            return findEarliestCore(m_FreeTimes, m_Cores);
+
+        return static_cast<int>(m_Winners[1]);
+    }
+
+    /**
+     * @brief Returns the time in which the specified core becomes free.
+     */
+    ENGINE_INLINE timestamp_t getFreeTime(const int core) const
+    {
+        return m_FreeTimes[core];
+    }
+
+    /**
+     * @brief Sets the time in which the specified core becomes free.
+     *
+     * @param core the core's index, in the interval [0, cores - 1]
+     * @param time the time in which the core becomes free
+     */
+    ENGINE_INLINE void setFreeTime(const int core, const timestamp_t time)
+    {
+        m_FreeTimes[core] = time;
+
+        if (!m_Winners)
+            return;
+
+        for (uint32_t node = (m_LeafCount + core) / 2U; node > 0U; node /= 2U)
+            playMatch(node);
+    }
+
+    ENGINE_INLINE int getCoreCount() const
+    {
+        return m_Cores;
+    }
+
+    /**
+     * @brief Returns true if the earliest core is selected through the
+     *        tournament tree, and false if it is selected by the linear scan.
+     */
+    ENGINE_INLINE bool hasTournamentTree() const
+    {
+        return m_Winners != nullptr;
+    }
+
+private:
+    /**
+     * @brief Sets the winner of the specified inner node from the winners of
+     *        its children, favoring the left one in case of a tie.
+     */
+    ENGINE_INLINE void playMatch(const uint32_t node)
+    {
+        const uint32_t left  = m_Winners[2U * node];
+        const uint32_t right = m_Winners[2U * node + 1U];
+
+        m_Winners[node] = m_FreeTimes[right] < m_FreeTimes[left] ? right : left;
+    }
+
+    int m_Cores;
+
+    /**
+     * @brief The amount of leaves of the tree, which is the least power of
+     *        two that is not less than the amount of cores.
+     */
+    uint32_t m_LeafCount = 1U;
+
+    /**
+     * @brief The time in which each leaf's core becomes free.
+     */
+    timestamp_t *m_FreeTimes;
+
+    /**
+     * @brief The winner's core index of each node. The root is the node 1,
+     *        the children of the node `i` are the nodes `2i` and `2i + 1`,
+     *        and the leaf of the i-th core is the node `leaves + i`.
+     *
+     *        It is null if the earliest core is selected by the linear scan.
+     */
+    uint32_t *m_Winners = nullptr;
+};
+
+#endif // ENGINE_CORE_SCHEDULER_HPP
@@ -0,0 +1,107 @@
+#ifndef ENGINE_SERVICE_DISPATCH_HPP
+#define ENGINE_SERVICE_DISPATCH_HPP
+
+#include <core/core.hpp>
+#include <service/cluster.hpp>
+#include <service/dummy.hpp>
+#include <service/link.hpp>
+#include <service/machine.hpp>
+#include <service/master.hpp>
+#include <service/service.hpp>
+#include <service/sharing_machine.hpp>
+#include <service/switch.hpp>
+
+/**
+ * @brief It calls the task arrival handler of the specified service.
+ *
+ * @details
+ *        The handlers of the built-in services are called directly, selected
+ *        by the service's kind, such that, the compiler is able to inline
+ *        them into the dispatcher. The handlers of the services defined by
+ *        the user are called virtually.
+ *
+ * @param service the service that has received the task
+ * @param now the time in which the task has arrived
+ * @param event the event which caused the handler to be called
+ */
+ENGINE_INLINE void
+dispatchTaskArrival(Service *service, const timestamp_t now, const Event *event)
+{
+    switch (service->getKind()) {
+    case ServiceKind::LINK:
+        static_cast<Link *>(service)->Link::onTaskArrival(now, event);
+        break;
+    case ServiceKind::SWITCH:
+        static_cast<Switch *>(service)->Switch::onTaskArrival(now, event);
+        break;
+    case ServiceKind::MACHINE:
+        static_cast<Machine *>(service)->Machine::onTaskArrival(now, event);
+        break;
+    case ServiceKind::MASTER:
+        static_cast<Master *>(service)->Master::onTaskArrival(now, event);
+        break;
+    case ServiceKind::DUMMY:
+        static_cast<Dummy *>(service)->Dummy::onTaskArrival(now, event);
+        break;
+    case ServiceKind::CLUSTER:
+        static_cast<Cluster *>(service)->Cluster::onTaskArrival(now, event);
+        break;
+    case ServiceKind::SHARING_MACHINE:
+        static_cast<SharingMachine *>(service)->SharingMachine::onTaskArrival(
+            now, event);
+        break;
+    default:
+        service->onTaskArrival(now, event);
+        break;
+    }
+}
+
+/**
+ * @brief It calls the reverse task arrival handler of the specified service.
+ *
+ * @details
+ *        The handlers are selected in the same way as in
+ *        `dispatchTaskArrival`.
+ *
+ * @param service the service that has processed the task
+ * @param now the time in which the task has arrived
+ * @param event the event which has been processed
+ */
+ENGINE_INLINE void dispatchTaskArrivalReverse(Service          *service,
+                                              const timestamp_t now,
+                                              const Event      *event)
+{
+    switch (service->getKind()) {
+    case ServiceKind::LINK:
+        static_cast<Link *>(service)->Link::onTaskArrivalReverse(now, event);
+        break;
+    case ServiceKind::SWITCH:
+        static_cast<Switch *>(service)->Switch::onTaskArrivalReverse(now,
+                                                                     event);
+        break;
+    case ServiceKind::MACHINE:
+        static_cast<Machine *>(service)->Machine::onTaskArrivalReverse(now,
+                                                                       event);
+        break;
+    case ServiceKind::MASTER:
+        static_cast<Master *>(service)->Master::onTaskArrivalReverse(now,
+                                                                     event);
+        break;
+    case ServiceKind::DUMMY:
+        static_cast<Dummy *>(service)->Dummy::onTaskArrivalReverse(now, event);
+        break;
+    case ServiceKind::CLUSTER:
+        static_cast<Cluster *>(service)->Cluster::onTaskArrivalReverse(now,
+                                                                       event);
+        break;
+    case ServiceKind::SHARING_MACHINE:
+        static_cast<SharingMachine *>(service)
+            ->SharingMachine::onTaskArrivalReverse(now, event);
+        break;
+    default:
+        service->onTaskArrivalReverse(now, event);
+        break;
+    }
+}
+
+#endif // ENGINE_SERVICE_DISPATCH_HPP
@@ -3,16 +3,26 @@
 
 #include <service/service.hpp>
 
-class Dummy : public Service
+class Dummy final : public Service
 {
 public:
-    explicit Dummy(const sid_t id) : Service(id)
+    explicit Dummy(const sid_t id) : Service(id, ServiceKind::DUMMY)
     {}
 
     void onTaskArrival(timestamp_t time, const Event *event) override
     {
         // Does nothing.
     }
+
+    void onTaskArrivalReverse(timestamp_t time, const Event *event) override
+    {
+        // Does nothing.
+    }
+
+    bool isReversible() const override
+    {
+        return true;
+    }
 };
 
 #endif // ENGINE_DUMMY_HPP
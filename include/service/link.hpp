@@ -1,6 +1,7 @@
 #ifndef ENGINE_LINK_HPP
 #define ENGINE_LINK_HPP
 
+#include <cstdint>
 #include <service/service.hpp>
 
 struct LinkMetrics
@@ -10,7 +11,45 @@ struct LinkMetrics
     double m_CommTasks;
 };
 
-class Link : public Service
+/**
+ * @brief An enumeration that lists the ways in which a link may share its
+ *        bandwidth between its two directions.
+ */
+enum class LinkDuplex : uint8_t
+{
+    /**
+     * @brief The packets in both directions are communicated one at a time,
+     *        in a single queue.
+     */
+    HALF,
+
+    /**
+     * @brief Each direction has its own queue, such that, the packets in one
+     *        direction never wait for the packets in the other direction.
+     */
+    FULL
+};
+
+/**
+ * @brief An enumeration that lists the directions in which a link may
+ *        communicate a packet.
+ */
+enum class LinkDirection : uint8_t
+{
+    /**
+     * @brief The packet is communicated from the link's source to the link's
+     *        destination.
+     */
+    FROM_TO,
+
+    /**
+     * @brief The packet is communicated from the link's destination to the
+     *        link's source.
+     */
+    TO_FROM
+};
+
+class Link final : public Service
 {
 public:
     /**
@@ -23,11 +62,13 @@ public:
      * @param bandwidth the bandwidth in megabits
      * @param loadFactor the load factor (a value in the interval [0, 1])
      * @param latency the latency in seconds
+     * @param duplex the way in which the bandwidth is shared between the
+     *               link's directions
      */
     explicit Link(const sid_t id, const sid_t from, const sid_t to, const double bandwidth, const double loadFactor,
-                  const double latency)
-        : Service(id), m_From(from), m_To(to), m_Bandwidth(bandwidth), m_LoadFactor(loadFactor), m_Latency(latency),
-          m_AvailableTime(0.0)
+                  const double latency, const LinkDuplex duplex = LinkDuplex::HALF)
+        : Service(id, ServiceKind::LINK), m_From(from), m_To(to), m_Bandwidth(bandwidth), m_LoadFactor(loadFactor), m_Latency(latency),
+          m_Duplex(duplex)
     {}
 
     /**
@@ -50,30 +91,145 @@ public:
 
     void onTaskArrival(timestamp_t, const Event *event) override;
 
+    void onTaskArrivalReverse(timestamp_t, const Event *event) override;
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Returns the link's lookahead.
+     *
+     * @details
+     *        Every packet sent by the link is delayed at least by its latency,
+     *        since it is added to the communication time of every packet.
+     *
+     * @return the link's latency
+     */
+    timestamp_t getLookahead() const override
+    {
+        return m_Latency;
+    }
+
     /**
-     * @brief Returns a const (read-only) reference to the machine metrics.
+     * @brief Returns the link's metrics summed over both directions.
      *
-     * @return a const (read-only) reference to the machine metrics
+     * @return the link's metrics summed over both directions
+     */
+    LinkMetrics getMetrics() const
+    {
+        const LinkMetrics &fromTo = m_Metrics[0];
+        const LinkMetrics &toFrom = m_Metrics[1];
+
+        return LinkMetrics{fromTo.m_CommMBits + toFrom.m_CommMBits,
+                           fromTo.m_CommTime + toFrom.m_CommTime,
+                           fromTo.m_CommTasks + toFrom.m_CommTasks};
+    }
+
+    /**
+     * @brief Returns a const (read-only) reference to the link metrics in the
+     *        specified direction.
+     *
+     * @param direction the direction of the metrics
+     *
+     * @return a const (read-only) reference to the link metrics in the
+     *         specified direction
+     */
+    const LinkMetrics &getMetrics(const LinkDirection direction) const
+    {
+        return m_Metrics[static_cast<int>(direction)];
+    }
+
+    /**
+     * @brief Returns the way in which the bandwidth is shared between the
+     *        link's directions.
      */
-    const LinkMetrics &getMetrics() const
+    LinkDuplex getDuplex() const
     {
-        return m_Metrics;
+        return m_Duplex;
     }
 
-    ENGINE_TEMPORARY timestamp_t getLocalVirtualTime() const
+    /**
+     * @brief Returns the identifier of the link's outgoing connection.
+     */
+    ENGINE_INLINE sid_t getFrom() const
     {
-        return m_Lvt;
+        return m_From;
+    }
+
+    /**
+     * @brief Returns the identifier of the link's ingoing connection.
+     */
+    ENGINE_INLINE sid_t getTo() const
+    {
+        return m_To;
+    }
+
+    /**
+     * @brief Returns the time in which the last packet communicated in the
+     *        specified direction leaves the link.
+     *
+     * @details
+     *        In the full-duplex mode, each direction has its own time, which
+     *        is a lower bound on the departures of the packets that are yet
+     *        to arrive in that direction. In the half-duplex mode, both
+     *        directions share the same time.
+     */
+    ENGINE_TEMPORARY timestamp_t
+    getLocalVirtualTime(const LinkDirection direction) const
+    {
+        return m_AvailableTime[getQueue(direction)];
     }
 
 private:
-    LinkMetrics                  m_Metrics{};
-    sid_t                        m_From;
-    sid_t                        m_To;
-    double                       m_Bandwidth;
-    double                       m_Latency;
-    double                       m_LoadFactor;
-    timestamp_t                  m_AvailableTime;
-    ENGINE_TEMPORARY timestamp_t m_Lvt{};
+    /**
+     * @brief Returns the direction in which the specified packet is
+     *        communicated, that is, away from the end that has sent it.
+     *
+     *        However, if the packet has not been sent by any of the link's
+     *        ends, then the program is immediately aborted.
+     */
+    ENGINE_INLINE LinkDirection getDirection(const Event *event) const
+    {
+        const sid_t previous = event->getRouteDescriptor().getPreviousService();
+
+        if (previous == m_From)
+            return LinkDirection::FROM_TO;
+
+        if (UNLIKELY(previous != m_To))
+            die("Link with id %llu has received a packet from a service "
+                "different from its ends.",
+                getId());
+
+        return LinkDirection::TO_FROM;
+    }
+
+    /**
+     * @brief Returns the index of the queue of the specified direction. In
+     *        the half-duplex mode, both directions share the first queue.
+     */
+    ENGINE_INLINE int getQueue(const LinkDirection direction) const
+    {
+        return m_Duplex == LinkDuplex::FULL ? static_cast<int>(direction) : 0;
+    }
+
+    /**
+     * @brief The link's metrics, indexed by the direction.
+     */
+    LinkMetrics m_Metrics[2]{};
+    sid_t       m_From;
+    sid_t       m_To;
+    double      m_Bandwidth;
+    double      m_Latency;
+    double      m_LoadFactor;
+    LinkDuplex  m_Duplex;
+
+    /**
+     * @brief The time in which each queue becomes available, indexed by the
+     *        direction. In the half-duplex mode, only the first is used.
+     */
+    timestamp_t m_AvailableTime[2]{};
 };
 
 #endif // ENGINE_LINK_HPP
@@ -3,7 +3,7 @@
 
 #include <allocator/rootsim_allocator.hpp>
 #include <core/core.hpp>
-#include <limits>
+#include <service/core_scheduler.hpp>
 #include <service/service.hpp>
 
 struct MachineMetrics
@@ -24,7 +24,46 @@ struct MachineMetrics
     unsigned m_ForwardedPackets;
 };
 
-class Machine : public Service
+/**
+ * @brief It forwards the specified packet, which has been received by the
+ *        specified machine, to the next service in the packet's route.
+ *
+ * @param machineId the identifier of the machine that forwards the packet
+ * @param time the time in which the packet has arrived
+ * @param event the event which has been received
+ */
+ENGINE_INLINE void doMachinePacketForwarding(const sid_t       machineId,
+                                             const timestamp_t time,
+                                             const Event      *event)
+{
+    const auto &routeDescriptor = event->getRouteDescriptor();
+
+    const auto source           = routeDescriptor.getSource();
+    const auto destination      = routeDescriptor.getDestination();
+    const auto offset           = routeDescriptor.getOffset();
+    const auto forwardDirection = routeDescriptor.getForwardingDirection();
+    const auto newOffset = forwardDirection ? offset + 1ULL : offset - 1ULL;
+
+    // It fetches the next service in the route, which is obtained from the
+    // forwarding table if it is set. Otherwise, it is read from the event
+    // itself if the route is carried inline, or it is fetched from the route
+    // provider using the source and destination identifier.
+    const uint32_t next = g_ForwardingTable
+                              ? event->getNextHop(machineId)
+                              : event->getHop(offset);
+
+    // Prepare the event to be send to the next service, which carries the
+    // route inline if the received event does.
+    SourceRoutedEvent e(
+        event->getTask(),
+        RouteDescriptor(
+            source, destination, machineId, newOffset, forwardDirection),
+        *event);
+
+    ispd::schedule_event(next, time, TASK_ARRIVAL, &e, e.getSize());
+}
+
+class Machine final : public Service
 {
 public:
     /**
@@ -41,15 +80,16 @@ public:
      * @param power the machine's power in megaflops
      * @param loadFactor the load factor (a value in the interval [0, 1])
      * @param cores the amount of cores
+     * @param selection the way in which the core that processes each task
+     *                  is selected
      */
-    explicit Machine(const sid_t  id,
-                     const double power,
-                     const double loadFactor,
-                     const int    cores)
-        : Service(id), m_PowerPerProc(power / cores), m_LoadFactor(loadFactor),
-          m_Cores(cores),
-          m_CoreFreeTimes(
-              ROOTSimAllocator<timestamp_t>::allocate<timestamp_t>(cores))
+    explicit Machine(const sid_t         id,
+                     const double        power,
+                     const double        loadFactor,
+                     const int           cores,
+                     const CoreSelection selection = CoreSelection::AUTOMATIC)
+        : Service(id, ServiceKind::MACHINE), m_PowerPerProc(power / cores),
+          m_LoadFactor(loadFactor), m_CoreScheduler(cores, selection)
     {}
 
     /**
@@ -75,8 +115,10 @@ public:
      *        specified machine. In other words, it is calculated the waiting
      *        time of a task to be processed by one of the machine's core.
      *
-     *        Moreover, the core of the machine to process the task is set
-     *        in the placeholder.
+     *        Moreover, the core of the machine to process the task, that is,
+     *        the core that becomes free the earliest, is set in the
+     *        placeholder. It is obtained in constant time from the core
+     *        scheduler.
      *
      * @param core the placeholder in which will be put the index of the
      *             core that will process the task. The core index is in
@@ -88,18 +130,8 @@ public:
      */
     ENGINE_INLINE double timeToAttend(int *core) const
     {
-        timestamp_t leastCoreTime = std::numeric_limits<timestamp_t>::max();
-        int         coreIndex;
-
-        for (int i = 0; i < m_Cores; i++) {
-            if (leastCoreTime > m_CoreFreeTimes[i]) {
-                leastCoreTime = m_CoreFreeTimes[i];
-                coreIndex     = i;
-            }
-        }
-
-        *core = coreIndex;
-        return leastCoreTime;
+        *core = m_CoreScheduler.getEarliestCore();
+        return m_CoreScheduler.getFreeTime(*core);
     }
 
     /**
@@ -110,6 +142,19 @@ public:
      */
     void onTaskArrival(timestamp_t time, const Event *event) override;
 
+    /**
+     * @brief It reverses the processing of the arrival of a task.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been processed
+     */
+    void onTaskArrivalReverse(timestamp_t time, const Event *event) override;
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
     /**
      * @brief It returns a const (read-only) reference to the machine metrics.
      *
@@ -124,8 +169,7 @@ private:
     MachineMetrics m_Metrics{};
     double         m_PowerPerProc;
     double         m_LoadFactor;
-    int            m_Cores;
-    timestamp_t   *m_CoreFreeTimes;
+    CoreScheduler  m_CoreScheduler;
 };
 
 #endif // ENGINE_MACHINE_HPP
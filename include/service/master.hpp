@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <allocator/rootsim_allocator.hpp>
 #include <scheduler/scheduler.hpp>
+#include <service/cluster.hpp>
 #include <service/service.hpp>
 #include <vector>
 #include <workload/workload.hpp>
@@ -15,17 +16,25 @@ struct MasterMetrics
     unsigned    m_CompletedTasks;
 };
 
-class Master : public Service
+class Master final : public Service
 {
 public:
     explicit Master(const sid_t id, Scheduler *scheduler)
-        : Service(id), m_Scheduler(scheduler), m_Links(new std::vector<sid_t>())
+        : Service(id, ServiceKind::MASTER), m_Scheduler(scheduler),
+          m_Links(new std::vector<sid_t>())
     {
         scheduler->setMaster(this);
     }
 
     void onSchedulerInit(timestamp_t now);
 
+    /**
+     * @brief It reverses the scheduler initialization.
+     *
+     * @param now the time in which the scheduler has been initialized
+     */
+    void onSchedulerInitReverse(timestamp_t now);
+
     /**
      * @brief It schedules the specified task to a scheduled slave.
      *
@@ -37,6 +46,37 @@ public:
      */
     void onTaskArrival(timestamp_t time, const Event *event) override;
 
+    /**
+     * @brief It reverses the processing of the arrival of a task.
+     *
+     * @param time the time in which this task has arrived
+     * @param event the event which has been processed
+     */
+    void onTaskArrivalReverse(timestamp_t time, const Event *event) override;
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief Returns true if the master has no remaining workload, every
+     *        injected task has arrived and every task it has dispatched has
+     *        been completed.
+     *
+     * @return true if the master is quiescent
+     */
+    bool isQuiescent() const override
+    {
+        if (m_Workload && m_Workload->hasRemainingWorkload())
+            return false;
+
+        if (m_PendingArrivals)
+            return false;
+
+        return m_Metrics.m_CompletedTasks == m_DispatchedTasks;
+    }
+
     ENGINE_INLINE
     void addSlave(const sid_t slaveId)
     {
@@ -47,6 +87,38 @@ public:
         m_Scheduler->addResource(slaveId);
     }
 
+    /**
+     * @brief Adds each machine of the specified cluster as a slave, such that,
+     *        the scheduler schedules the cluster's machines one by one.
+     *
+     * @param clusterId the cluster's identifier
+     * @param machines the cluster's amount of machines
+     */
+    ENGINE_INLINE
+    void addClusterSlaves(const sid_t clusterId, const uint32_t machines)
+    {
+        for (uint32_t member = 0; member < machines; member++)
+            m_Scheduler->addResource(makeClusterSlaveId(clusterId, member));
+    }
+
+    /**
+     * @brief Adds the specified amount of tasks that have been injected in
+     *        this master as events, such that, the master is not quiescent
+     *        until every one of them has arrived.
+     *
+     * @details
+     *        It must be called while the master is initialized, along with
+     *        the scheduling of the events that carry the tasks, whose origin
+     *        must be this master.
+     *
+     * @param count the amount of injected tasks
+     */
+    ENGINE_INLINE
+    void addPendingArrivals(const unsigned count)
+    {
+        m_PendingArrivals += count;
+    }
+
     ENGINE_INLINE
     const MasterMetrics &getMetrics() const
     {
@@ -60,7 +132,7 @@ public:
     }
 
 public:
-    Workload *m_Workload;
+    Workload *m_Workload = nullptr;
 
 private:
     Scheduler *m_Scheduler;
@@ -87,7 +159,18 @@ private:
     // just for the master know who is his slaves.
     std::vector<sid_t> *m_Links;
 
+    /**
+     * @brief The amount of tasks that this master has dispatched to its
+     *        slaves, either taken from its workload or received to be
+     *        scheduled.
+     */
+    unsigned m_DispatchedTasks = 0U;
 
+    /**
+     * @brief The amount of tasks that have been injected in this master as
+     *        events and that have not arrived yet.
+     */
+    unsigned m_PendingArrivals = 0U;
 
     MasterMetrics m_Metrics{};
 };
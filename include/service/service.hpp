@@ -1,9 +1,31 @@
 #ifndef ENGINE_SERVICE_HPP
 #define ENGINE_SERVICE_HPP
 
+#include <cstdint>
 #include <engine.hpp>
 #include <event/event.hpp>
 
+/**
+ * @brief The kind of a service.
+ *
+ * @details
+ *        The kind is used by the dispatchers to call the event handlers of the
+ *        built-in services directly, without a virtual call. The services
+ *        defined by the user are of the `USER` kind, whose handlers are
+ *        called virtually.
+ */
+enum class ServiceKind : uint8_t
+{
+    USER,
+    LINK,
+    SWITCH,
+    MACHINE,
+    MASTER,
+    DUMMY,
+    CLUSTER,
+    SHARING_MACHINE
+};
+
 class Service
 {
 public:
@@ -18,7 +40,22 @@ public:
      *
      * @param id the service's id
      */
-    explicit Service(const sid_t id) : m_Id(id)
+    explicit Service(const sid_t id) : m_Id(id), m_Kind(ServiceKind::USER)
+    {}
+
+    /**
+     * @brief Constructs a @p Service with the specified @p id and @p kind.
+     *
+     * @details
+     *        This constructor is used by the built-in services. A service
+     *        that is not of the `USER` kind must be the final class of its
+     *        kind, since its handlers are called without a virtual call.
+     *
+     * @param id the service's id
+     * @param kind the service's kind
+     */
+    explicit Service(const sid_t id, const ServiceKind kind)
+        : m_Id(id), m_Kind(kind)
     {}
 
     /**
@@ -29,6 +66,80 @@ public:
      */
     virtual void onTaskArrival(timestamp_t time, const Event *event) = 0;
 
+    /**
+     * @brief It reverses the processing of the arrival of a task.
+     *
+     * @details
+     *        The reverse handler must restore the service's state to the
+     *        exact state it had before the forward handler has processed the
+     *        same event. The values overwritten by the forward handler that
+     *        cannot be recomputed are obtained through `ispd::reverse_data`.
+     *
+     *        The events scheduled and the random numbers drawn by the forward
+     *        handler are reversed by the engine, therefore, the reverse
+     *        handler must neither schedule events nor draw random numbers.
+     *
+     *        By default, the service does not support reverse computation and
+     *        the program is immediately aborted.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been processed
+     */
+    virtual void onTaskArrivalReverse(timestamp_t time, const Event *event)
+    {
+        die("Service with id %llu does not support reverse computation.",
+            getId());
+    }
+
+    /**
+     * @brief Returns true if the service implements the reverse handlers of
+     *        all its forward handlers.
+     *
+     * @return true if the service supports reverse computation
+     */
+    virtual bool isReversible() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Returns the service's lookahead.
+     *
+     * @details
+     *        The lookahead is a lower bound on the difference between the
+     *        timestamp of any event scheduled by this service and the
+     *        timestamp of the event being processed. It is used by the
+     *        conservative engines to determine which events are safe to be
+     *        processed.
+     *
+     *        By default, a service has no lookahead, that is, it may schedule
+     *        events at the same time that it has received one.
+     *
+     * @return the service's lookahead
+     */
+    virtual timestamp_t getLookahead() const
+    {
+        return 0.0;
+    }
+
+    /**
+     * @brief Returns true if the service is quiescent.
+     *
+     * @details
+     *        A quiescent service will not generate new work by itself, that
+     *        is, it only forwards or processes the work sent by the other
+     *        services. The simulation is terminated as soon as every service
+     *        is quiescent in its committed state.
+     *
+     *        By default, a service is always quiescent.
+     *
+     * @return true if the service is quiescent
+     */
+    virtual bool isQuiescent() const
+    {
+        return true;
+    }
+
     /**
      * Returns the service's id.
      *
@@ -39,8 +150,19 @@ public:
         return m_Id;
     }
 
+    /**
+     * Returns the service's kind.
+     *
+     * @return the service's kind
+     */
+    ServiceKind getKind() const
+    {
+        return m_Kind;
+    }
+
 private:
-    sid_t m_Id;
+    sid_t       m_Id;
+    ServiceKind m_Kind;
 };
 
 #endif // ENGINE_SERVICE_HPP
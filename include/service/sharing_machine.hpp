@@ -0,0 +1,243 @@
+#ifndef ENGINE_SHARING_MACHINE_HPP
+#define ENGINE_SHARING_MACHINE_HPP
+
+#include <allocator/rootsim_allocator.hpp>
+#include <core/core.hpp>
+#include <cstdint>
+#include <service/machine.hpp>
+#include <service/service.hpp>
+
+/**
+ * @brief The content of the event that a processor-sharing machine sends to
+ *        itself at the time in which its next task is expected to depart.
+ *
+ * @details
+ *        The departure is only valid if no task has arrived or departed since
+ *        it has been scheduled, that is, if its epoch is still the machine's
+ *        epoch. Otherwise, it is ignored. Further, it carries the machine's
+ *        virtual time bookkeeping at the time in which it has been scheduled,
+ *        such that, a valid departure is reversed without saving them.
+ */
+struct TaskDeparture
+{
+    uint64_t    m_Epoch;
+    timestamp_t m_UpdateTime;
+    double      m_VirtualTime;
+};
+
+/**
+ * @brief A task that is being processed by a processor-sharing machine.
+ */
+struct SharingJob
+{
+    /**
+     * @brief The virtual time in which the task finishes its processing.
+     */
+    double m_FinishTag;
+
+    Task            m_Task;
+    RouteDescriptor m_RouteDescriptor;
+};
+
+/**
+ * @brief A processor-sharing machine is a machine whose cores are equally
+ *        shared among every task that is being processed, instead of each
+ *        core processing one task at a time in the arrival order.
+ *
+ * @details
+ *        If there are `n` tasks in a machine with `c` cores, then each task
+ *        is processed at the fraction `min(1, c / n)` of a core's speed. The
+ *        machine keeps a virtual time, which advances at that fraction of
+ *        the real time. Therefore, a task that arrives at the virtual time
+ *        `v` and takes `p` seconds to be processed by a core finishes at the
+ *        virtual time `v + p` (its finish tag), regardless of the tasks that
+ *        arrive or depart in the meantime. The tasks are kept in a binary
+ *        min-heap by their finish tags.
+ *
+ *        Only the next departure is scheduled, as an event that the machine
+ *        sends to itself. Whenever a task arrives or departs, the rate of
+ *        the virtual time changes, therefore, a new departure is scheduled
+ *        and the previous one becomes stale, which is detected by the epoch
+ *        carried in the departure (see `TaskDeparture`). Hence, each task
+ *        costs a constant amount of events, however many tasks share the
+ *        machine.
+ *
+ *        The tasks destined to other services are forwarded as the `Machine`
+ *        does.
+ */
+class SharingMachine final : public Service
+{
+public:
+    /**
+     * @param id the machine's identifier
+     * @param power the machine's power in megaflops
+     * @param loadFactor the load factor (a value in the interval [0, 1])
+     * @param cores the amount of cores
+     */
+    explicit SharingMachine(const sid_t  id,
+                            const double power,
+                            const double loadFactor,
+                            const int    cores)
+        : Service(id, ServiceKind::SHARING_MACHINE),
+          m_PowerPerProc(power / cores), m_LoadFactor(loadFactor),
+          m_Cores(cores)
+    {
+        if (UNLIKELY(cores <= 0))
+            die("A machine with %d cores is not supported.", cores);
+    }
+
+    /**
+     * @brief It calculates the time taken in seconds by a core to process a
+     *        task with the specified processing size in megaflops, if the
+     *        core is not shared.
+     */
+    ENGINE_INLINE double timeToProcess(const double procSize) const
+    {
+        return procSize / ((1.0 - m_LoadFactor) * m_PowerPerProc);
+    }
+
+    /**
+     * @brief Returns the fraction of a core's speed that each task receives
+     *        while the specified amount of tasks are being processed.
+     */
+    ENGINE_INLINE double getShare(const uint32_t jobs) const
+    {
+        return jobs <= static_cast<uint32_t>(m_Cores)
+                   ? 1.0
+                   : static_cast<double>(m_Cores) / jobs;
+    }
+
+    /**
+     * @brief It processes the arrival of a task.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been received
+     */
+    void onTaskArrival(timestamp_t time, const Event *event) override;
+
+    /**
+     * @brief It reverses the processing of the arrival of a task.
+     *
+     * @param time the time in which the task has arrived
+     * @param event the event which has been processed
+     */
+    void onTaskArrivalReverse(timestamp_t time, const Event *event) override;
+
+    /**
+     * @brief It processes a departure, which, if it is still valid, sends
+     *        back the task with the least finish tag and schedules the next
+     *        departure.
+     *
+     * @param time the time of the departure
+     * @param departure the departure which has been received
+     */
+    void onTaskDeparture(timestamp_t time, const TaskDeparture *departure);
+
+    /**
+     * @brief It reverses the processing of a departure.
+     *
+     * @param time the time of the departure
+     * @param departure the departure which has been processed
+     */
+    void onTaskDepartureReverse(timestamp_t          time,
+                                const TaskDeparture *departure);
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
+    /**
+     * @brief It returns a const (read-only) reference to the machine metrics.
+     *
+     * @details
+     *        The processed time of a task is the time it takes to be
+     *        processed by a core that is not shared.
+     */
+    const MachineMetrics &getMetrics() const
+    {
+        return m_Metrics;
+    }
+
+    /**
+     * @brief Returns the amount of tasks that are being processed.
+     */
+    ENGINE_INLINE uint32_t getJobCount() const
+    {
+        return m_JobCount;
+    }
+
+private:
+    /**
+     * @brief It advances the virtual time up to the specified time.
+     */
+    ENGINE_INLINE void advance(const timestamp_t time)
+    {
+        if (m_JobCount > 0U)
+            m_VirtualTime += (time - m_UpdateTime) * getShare(m_JobCount);
+
+        m_UpdateTime = time;
+    }
+
+    /**
+     * @brief It schedules the departure of the task with the least finish
+     *        tag, if there is any task, under the current epoch.
+     */
+    void scheduleDeparture(timestamp_t time);
+
+    /**
+     * @brief It inserts the specified task in the heap.
+     *
+     * @return the task's position in the heap
+     */
+    uint32_t pushJob(const SharingJob &job);
+
+    /**
+     * @brief It removes the task that has been inserted in the specified
+     *        position by the last `pushJob`.
+     */
+    void pushJobReverse(uint32_t position);
+
+    /**
+     * @brief It removes the task with the least finish tag from the heap.
+     *
+     * @return the position in which the heap's last task has been put
+     */
+    uint32_t popJob();
+
+    /**
+     * @brief It inserts back the task that has been removed by the last
+     *        `popJob`, which has returned the specified position.
+     */
+    void popJobReverse(const SharingJob &job, uint32_t position);
+
+    MachineMetrics m_Metrics{};
+    double         m_PowerPerProc;
+    double         m_LoadFactor;
+    int            m_Cores;
+
+    /**
+     * @brief The virtual time, in seconds of a core that is not shared, at
+     *        the time of the last arrival or departure.
+     */
+    double      m_VirtualTime = 0.0;
+    timestamp_t m_UpdateTime  = 0.0;
+
+    /**
+     * @brief The epoch of the departure that is currently scheduled, which
+     *        is incremented on every arrival and departure.
+     */
+    uint64_t m_Epoch = 0ULL;
+
+    /**
+     * @brief The binary min-heap of the tasks by their finish tags, whose
+     *        storage is allocated through the ROOT-Sim allocator and grows
+     *        as needed. The root is at the position 0, and the children of
+     *        the position `i` are at the positions `2i + 1` and `2i + 2`.
+     */
+    SharingJob *m_Jobs        = nullptr;
+    uint32_t    m_JobCount    = 0U;
+    uint32_t    m_JobCapacity = 0U;
+};
+
+#endif // ENGINE_SHARING_MACHINE_HPP
@@ -16,7 +16,7 @@ struct SwitchMetrics
  * Switch is responsible for fowarding messages to other
  * machines through the links
  */
-class Switch : public Service
+class Switch final : public Service
 {
 public:
     /**
@@ -31,12 +31,19 @@ public:
                     const double bandwidth,
                     const double latency,
                     const double load_factor)
-        : Service(id), m_Bandwidth(bandwidth), m_Latency(latency),
+        : Service(id, ServiceKind::SWITCH), m_Bandwidth(bandwidth), m_Latency(latency),
           m_LoadFactor(load_factor), m_AvailableTime(0.0)
     {}
 
     void onTaskArrival(timestamp_t, const Event *event) override;
 
+    void onTaskArrivalReverse(timestamp_t, const Event *event) override;
+
+    bool isReversible() const override
+    {
+        return true;
+    }
+
     /**
      * It calculates the time taken in seconds to a switch communicate a
      * customer
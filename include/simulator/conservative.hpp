@@ -0,0 +1,59 @@
+#ifndef ENGINE_SIMULATOR_CONSERVATIVE_HPP
+#define ENGINE_SIMULATOR_CONSERVATIVE_HPP
+
+#include <cstdint>
+#include <simulator/native.hpp>
+#include <simulator/simulator.hpp>
+
+namespace ispd::sim
+{
+
+/// \class ConservativeSimulator
+///
+/// \brief Native conservative simulator class.
+///
+/// \details
+///        This class implements a multi-threaded conservative engine based on
+///        synchronous time windows (YAWNS). The services are partitioned among
+///        the threads and, at each window, every thread processes the events
+///        whose timestamps are less than the least pending timestamp plus the
+///        lookahead, that is, the minimum positive service lookahead.
+///
+///        In the current model, only the links have a lookahead, since the
+///        machines, switches and masters forward the packets at the same time
+///        they have been received. Therefore, each window is processed in two
+///        phases. First, the services without lookahead process their events,
+///        scheduling events to the links only. Then, after a synchronization,
+///        the services with lookahead process their events, whose generated
+///        events are all beyond the current window.
+///
+///        A link without lookahead, however, forwards the packets to its
+///        ends at the same time. Therefore, after the services have been
+///        initialized, such link and its ends without lookahead are assigned
+///        to the same thread. Any other event scheduled by a service without
+///        lookahead to another thread within the current window aborts the
+///        program.
+class ConservativeSimulator : public Simulator
+{
+public:
+    /// \brief ConservativeSimulator ctor.
+    ///
+    /// \param threads The amount of threads. If zero, the amount of hardware
+    ///                threads is used.
+    /// \param seed The seed used to initialize the services' random streams.
+    explicit ConservativeSimulator(const uint32_t threads, const uint64_t seed)
+        : m_Threads(threads), m_Seed(seed)
+    {}
+
+    /// \brief It executes the simulation in synchronous time windows until
+    ///        there are no more pending events.
+    void simulate() override;
+
+private:
+    uint32_t m_Threads;
+    uint64_t m_Seed;
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_CONSERVATIVE_HPP
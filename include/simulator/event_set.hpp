@@ -0,0 +1,252 @@
+#ifndef ENGINE_SIMULATOR_EVENT_SET_HPP
+#define ENGINE_SIMULATOR_EVENT_SET_HPP
+
+#include <algorithm>
+#include <core/core.hpp>
+#include <cstdint>
+#include <engine.hpp>
+#include <functional>
+#include <limits>
+#include <vector>
+
+/**
+ * Native Engine Time Representation
+ *
+ *  0 - Floating-point (timestamp_t)
+ *  1 - 64-bit Fixed-point Ticks
+ */
+#ifndef NATIVE_FIXED_POINT_TIME
+#    define NATIVE_FIXED_POINT_TIME 0
+#endif // NATIVE_FIXED_POINT_TIME
+
+namespace ispd::sim
+{
+
+#if NATIVE_FIXED_POINT_TIME == 0
+/// \brief The timestamp representation used to order the pending events.
+using EventTime = timestamp_t;
+
+/// \brief The event time that is greater than any other event time.
+constexpr EventTime EventTimeInfinity =
+    std::numeric_limits<timestamp_t>::infinity();
+
+/// \brief Converts a timestamp to an event time.
+ENGINE_INLINE EventTime toEventTime(const timestamp_t time)
+{
+    return time;
+}
+
+/// \brief Converts an event time to a timestamp.
+ENGINE_INLINE timestamp_t fromEventTime(const EventTime time)
+{
+    return time;
+}
+#elif NATIVE_FIXED_POINT_TIME == 1
+/// \brief The timestamp representation used to order the pending events.
+///
+/// The timestamps are represented by an unsigned 64-bit integer amount of
+/// ticks, in which a tick is 2^-30 seconds (about a nanosecond). Therefore, the
+/// events are ordered by integer comparisons and, since every tick amount
+/// below 2^53 is exactly representable by a double, the timestamps given to
+/// the event handlers are exact up to about 97 days of simulated time.
+using EventTime = uint64_t;
+
+/// \brief The amount of fractional bits of the fixed-point event time.
+constexpr int EventTimeFractionBits = 30;
+
+/// \brief The event time that is greater than any other event time.
+constexpr EventTime EventTimeInfinity = std::numeric_limits<uint64_t>::max();
+
+/// \brief Converts a timestamp to an event time.
+///
+/// The timestamp is rounded to the nearest tick. The rounding is monotonic,
+/// therefore, the order between the events is never inverted, although
+/// events less than half a tick apart may be tied.
+ENGINE_INLINE EventTime toEventTime(const timestamp_t time)
+{
+    constexpr timestamp_t Scale = 1ULL << EventTimeFractionBits;
+    constexpr timestamp_t Limit = 0x1.0p64;
+
+    // It checks if the timestamp cannot be represented by the event time. If
+    // so, the program is immediately aborted, unless the timestamp is the
+    // infinity, which is used to denote the absence of events.
+    if (UNLIKELY(!(time * Scale < Limit))) {
+        if (time == std::numeric_limits<timestamp_t>::infinity())
+            return EventTimeInfinity;
+
+        die("The timestamp %lf cannot be represented by the fixed-point event "
+            "time.",
+            time);
+    }
+
+    if (UNLIKELY(time < 0.0))
+        die("The timestamp %lf is negative.", time);
+
+    return static_cast<EventTime>(time * Scale + 0.5);
+}
+
+/// \brief Converts an event time to a timestamp.
+ENGINE_INLINE timestamp_t fromEventTime(const EventTime time)
+{
+    constexpr timestamp_t Tick = 1.0 / (1ULL << EventTimeFractionBits);
+
+    if (UNLIKELY(time == EventTimeInfinity))
+        return std::numeric_limits<timestamp_t>::infinity();
+
+    return static_cast<timestamp_t>(time) * Tick;
+}
+#else
+#    error "Unknown native engine time representation."
+#endif // NATIVE_FIXED_POINT_TIME
+
+/// \struct PendingEvent
+///
+/// \brief An entry of a pending event set.
+///
+/// The pending event entry is the (small) key that is moved around by the
+/// pending event set implementations. It contains only the information that is
+/// necessary to order the events, while the event content is kept in a slot
+/// that is indexed by \c m_Slot, such that, the event content is never copied
+/// by the pending event set.
+///
+/// Events are ordered by their timestamp, then, by the service that has
+/// scheduled them and, then, by their sequence number. The sequence number is
+/// the amount of events that had been scheduled by the same service before.
+/// Therefore, the order of events with the same timestamp depends only on the
+/// model, and neither on the engine nor on the amount of threads.
+struct PendingEvent
+{
+    EventTime m_Time;
+    uint64_t  m_Sequence;
+    uint32_t  m_Source;
+    uint32_t  m_Slot;
+
+    ENGINE_INLINE bool operator>(const PendingEvent &other) const
+    {
+        if (m_Time != other.m_Time)
+            return m_Time > other.m_Time;
+        if (m_Source != other.m_Source)
+            return m_Source > other.m_Source;
+        return m_Sequence > other.m_Sequence;
+    }
+
+    ENGINE_INLINE bool operator<(const PendingEvent &other) const
+    {
+        return other > *this;
+    }
+};
+
+/// \class BinaryHeapEventSet
+///
+/// \brief A pending event set backed by a binary heap.
+///
+/// This is the default pending event set used by the native engine. It has a
+/// O(log n) enqueue and dequeue costs and a good cache behavior while the
+/// amount of pending events is small.
+///
+/// The events inserted in bulk are appended after the heap without restoring
+/// the heap property, which is only restored when the set is next inspected.
+/// At that point, if the appended events are a significant fraction of the
+/// set, the heap is rebuilt in linear time instead of sifting up each one.
+class BinaryHeapEventSet
+{
+public:
+    /// \brief Insert a pending event in the set.
+    ///
+    /// \param event The pending event to be inserted.
+    ENGINE_INLINE void push(const PendingEvent &event)
+    {
+        m_Heap.push_back(event);
+
+        // It checks if there are events appended in bulk. If so, the event
+        // is appended with them and the heap property is restored later.
+        if (UNLIKELY(m_Heaped + 1 != m_Heap.size()))
+            return;
+
+        std::push_heap(m_Heap.begin(), m_Heap.end(), Compare());
+        m_Heaped++;
+    }
+
+    /// \brief Insert a pending event in the set as part of a bulk insertion.
+    ///
+    /// \param event The pending event to be inserted.
+    ENGINE_INLINE void pushBulk(const PendingEvent &event)
+    {
+        m_Heap.push_back(event);
+    }
+
+    /// \brief Returns the pending event with the least timestamp.
+    ///
+    /// \note It is the caller's responsibility to ensure that the set is not
+    ///       empty.
+    ///
+    /// \return The pending event with the least timestamp.
+    ENGINE_INLINE const PendingEvent &top()
+    {
+        if (UNLIKELY(m_Heaped != m_Heap.size()))
+            restore();
+
+        return m_Heap.front();
+    }
+
+    /// \brief Remove and return the pending event with the least timestamp.
+    ///
+    /// \note It is the caller's responsibility to ensure that the set is not
+    ///       empty.
+    ///
+    /// \return The pending event with the least timestamp.
+    ENGINE_INLINE PendingEvent pop()
+    {
+        if (UNLIKELY(m_Heaped != m_Heap.size()))
+            restore();
+
+        std::pop_heap(m_Heap.begin(), m_Heap.end(), Compare());
+
+        const PendingEvent event = m_Heap.back();
+        m_Heap.pop_back();
+        m_Heaped--;
+        return event;
+    }
+
+    /// \brief Returns true if there is no pending event in the set.
+    ENGINE_INLINE bool empty() const
+    {
+        return m_Heap.empty();
+    }
+
+    /// \brief Returns the amount of pending events in the set.
+    ENGINE_INLINE std::size_t size() const
+    {
+        return m_Heap.size();
+    }
+
+private:
+    using Compare = std::greater<PendingEvent>;
+
+    /// \brief Restore the heap property over the events inserted in bulk.
+    void restore()
+    {
+        const std::size_t appended = m_Heap.size() - m_Heaped;
+
+        // Sifting up costs O(log n) per appended event, while rebuilding the
+        // heap costs O(n). Therefore, the heap is rebuilt once the appended
+        // events are more than a small fraction of the set.
+        if (appended > m_Heap.size() / 16)
+            std::make_heap(m_Heap.begin(), m_Heap.end(), Compare());
+        else
+            for (std::size_t i = m_Heaped + 1; i <= m_Heap.size(); i++)
+                std::push_heap(m_Heap.begin(), m_Heap.begin() + i, Compare());
+
+        m_Heaped = m_Heap.size();
+    }
+
+    std::vector<PendingEvent> m_Heap;
+
+    /// \brief The amount of events, at the beginning of \c m_Heap, that
+    ///        satisfy the heap property.
+    std::size_t m_Heaped = 0;
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_EVENT_SET_HPP
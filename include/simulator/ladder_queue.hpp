@@ -0,0 +1,336 @@
+#ifndef ENGINE_SIMULATOR_LADDER_QUEUE_HPP
+#define ENGINE_SIMULATOR_LADDER_QUEUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <core/core.hpp>
+#include <cstdint>
+#include <limits>
+#include <simulator/event_set.hpp>
+#include <vector>
+
+namespace ispd::sim
+{
+
+/// \class LadderQueueEventSet
+///
+/// \brief A pending event set backed by a ladder queue.
+///
+/// The ladder queue (Tang, Goh and Thng, 2005) is a multi-list priority queue
+/// with O(1) amortized enqueue and dequeue costs. It is composed of three
+/// tiers.
+///
+/// - Top: an unsorted list that holds the events that are far in the future.
+///        Enqueueing in the top is a simple append.
+///
+/// - Rungs: a ladder of bucket arrays. The first rung is created by spreading
+///          the top events over buckets of equal width. Then, whenever a bucket
+///          to be dequeued holds too many events, a new rung with a finer
+///          bucket width is spawned from it.
+///
+/// - Bottom: a small sorted list holding the events that are about to be
+///           dequeued.
+///
+/// Bursts of events with the same timestamp, as the ones generated by the
+/// constant-sized workloads at t = 0, cannot be spread over buckets. Those
+/// bursts are moved straight to the bottom and sorted only once, such that,
+/// they are dequeued in O(1) each.
+class LadderQueueEventSet
+{
+public:
+    /// \brief Insert a pending event in the set.
+    ///
+    /// \param event The pending event to be inserted.
+    ENGINE_INLINE void push(const PendingEvent &event)
+    {
+        m_Size++;
+
+        // It checks if the event is beyond the ladder. If so, the event is
+        // simply appended to the top.
+        if (static_cast<timestamp_t>(event.m_Time) >= m_TopStart) {
+            pushTop(event);
+            return;
+        }
+
+        // It looks for the rung in which the event should be inserted. The
+        // search goes from the coarsest to the finest rung, as in the
+        // original ladder queue.
+        for (uint32_t i = 0; i < m_RungCount; i++) {
+            Rung          &rung   = m_Rungs[i];
+            const uint64_t bucket = rung.bucketOf(event.m_Time);
+
+            if (bucket >= rung.m_Current) {
+                rung.m_Buckets[bucket].push_back(event);
+                return;
+            }
+        }
+
+        pushBottom(event);
+    }
+
+    /// \brief Insert a pending event in the set as part of a bulk insertion.
+    ///
+    /// The ladder queue enqueue is already O(1) amortized, since the events
+    /// beyond the ladder are appended to the top, and the other ones are
+    /// appended to their buckets. Therefore, the event is simply inserted.
+    ///
+    /// \param event The pending event to be inserted.
+    ENGINE_INLINE void pushBulk(const PendingEvent &event)
+    {
+        push(event);
+    }
+
+    /// \brief Returns the pending event with the least timestamp.
+    ///
+    /// \note It is the caller's responsibility to ensure that the set is not
+    ///       empty.
+    ///
+    /// \return The pending event with the least timestamp.
+    ENGINE_INLINE const PendingEvent &top()
+    {
+        if (UNLIKELY(m_BottomHead == m_Bottom.size()))
+            refillBottom();
+
+        return m_Bottom[m_BottomHead];
+    }
+
+    /// \brief Remove and return the pending event with the least timestamp.
+    ///
+    /// \note It is the caller's responsibility to ensure that the set is not
+    ///       empty.
+    ///
+    /// \return The pending event with the least timestamp.
+    ENGINE_INLINE PendingEvent pop()
+    {
+        if (UNLIKELY(m_BottomHead == m_Bottom.size()))
+            refillBottom();
+
+        m_Size--;
+        return m_Bottom[m_BottomHead++];
+    }
+
+    /// \brief Returns true if there is no pending event in the set.
+    ENGINE_INLINE bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    /// \brief Returns the amount of pending events in the set.
+    ENGINE_INLINE std::size_t size() const
+    {
+        return m_Size;
+    }
+
+private:
+    /// \brief The amount of events in a bucket above which a new rung is
+    ///        spawned instead of sorting the bucket in the bottom.
+    static constexpr std::size_t Threshold = 50;
+
+    /// \brief The maximum amount of rungs in the ladder.
+    static constexpr uint32_t MaxRungs = 8;
+
+    /// \brief A rung of the ladder.
+    struct Rung
+    {
+        timestamp_t                            m_Start;
+        timestamp_t                            m_Width;
+        uint64_t                               m_BucketCount;
+        uint64_t                               m_Current;
+        std::vector<std::vector<PendingEvent>> m_Buckets;
+
+        /// \brief Returns the bucket in which an event with the specified
+        ///        timestamp should be inserted.
+        ///
+        /// \details
+        ///        The same computation is used both for inserting and for
+        ///        spreading the events, and it is monotonic in the timestamp,
+        ///        therefore, the events are never reordered across buckets
+        ///        due to floating-point rounding.
+        ENGINE_INLINE uint64_t bucketOf(const timestamp_t time) const
+        {
+            if (time <= m_Start)
+                return 0;
+
+            const timestamp_t bucket = (time - m_Start) / m_Width;
+
+            if (bucket >= static_cast<timestamp_t>(m_BucketCount - 1))
+                return m_BucketCount - 1;
+            return static_cast<uint64_t>(bucket);
+        }
+    };
+
+    ENGINE_INLINE void pushTop(const PendingEvent &event)
+    {
+        // The ladder bounds are kept as floating-point numbers regardless of
+        // the event time representation, since the bucket widths are
+        // fractional.
+        const timestamp_t time = static_cast<timestamp_t>(event.m_Time);
+
+        if (m_Top.empty()) {
+            m_TopMin = time;
+            m_TopMax = time;
+        }
+        else {
+            m_TopMin = std::min(m_TopMin, time);
+            m_TopMax = std::max(m_TopMax, time);
+        }
+
+        m_Top.push_back(event);
+    }
+
+    ENGINE_INLINE void pushBottom(const PendingEvent &event)
+    {
+        // The newly scheduled events are commonly later than all events in
+        // the bottom, therefore, the insertion is at the end most times.
+        const auto position = std::upper_bound(
+            m_Bottom.begin() + m_BottomHead, m_Bottom.end(), event);
+        m_Bottom.insert(position, event);
+    }
+
+    /// \brief Move the events that are next to be dequeued to the bottom.
+    void refillBottom()
+    {
+        m_Bottom.clear();
+        m_BottomHead = 0;
+
+        for (;;) {
+            // It checks if there are no rungs. If so, the top events are
+            // transferred to the ladder.
+            if (m_RungCount == 0) {
+                transferTop();
+
+                if (!m_Bottom.empty())
+                    return;
+                continue;
+            }
+
+            Rung &rung = m_Rungs[m_RungCount - 1];
+
+            // Look for the next non-empty bucket in the finest rung.
+            while (rung.m_Current < rung.m_BucketCount &&
+                   rung.m_Buckets[rung.m_Current].empty())
+                rung.m_Current++;
+
+            // It checks if the finest rung has been exhausted. If so, it is
+            // removed and the search continues in the coarser rung.
+            if (rung.m_Current == rung.m_BucketCount) {
+                m_RungCount--;
+                continue;
+            }
+
+            const uint64_t             index  = rung.m_Current++;
+            std::vector<PendingEvent> &bucket = rung.m_Buckets[index];
+
+            if (bucket.size() > Threshold && m_RungCount < MaxRungs &&
+                spawnRung(rung, index, bucket))
+                continue;
+
+            m_Bottom.swap(bucket);
+            std::sort(m_Bottom.begin(), m_Bottom.end());
+            return;
+        }
+    }
+
+    /// \brief Transfer the top events to the ladder.
+    void transferTop()
+    {
+        const std::size_t count = m_Top.size();
+        const timestamp_t width = (m_TopMax - m_TopMin) / count;
+
+        // It checks if the top events are few or they cannot be spread over
+        // buckets. If so, they are moved straight to the bottom.
+        if (count <= Threshold || !(width > 0.0)) {
+            m_Bottom.swap(m_Top);
+            std::sort(m_Bottom.begin(), m_Bottom.end());
+            m_TopStart = nextTopStart(m_TopMax);
+            return;
+        }
+
+        Rung &rung = prepareRung(m_TopMin, width, count + 1);
+
+        for (const PendingEvent &event : m_Top)
+            rung.m_Buckets[rung.bucketOf(event.m_Time)].push_back(event);
+
+        m_Top.clear();
+        m_TopStart =
+            std::max(m_TopMin + width * (count + 1), nextTopStart(m_TopMax));
+    }
+
+    /// \brief Returns the least top start that keeps the events with the
+    ///        specified timestamp out of the top.
+    ///
+    /// \details
+    ///        The events with the same timestamp of the transferred ones must
+    ///        be inserted in the ladder or in the bottom, in which they are
+    ///        ordered by their full key. Otherwise, if they were appended to
+    ///        the top, then they would be dequeued after all the transferred
+    ///        events, regardless of their sources and sequence numbers.
+    static ENGINE_INLINE timestamp_t nextTopStart(const timestamp_t time)
+    {
+        return std::nextafter(time,
+                              std::numeric_limits<timestamp_t>::infinity());
+    }
+
+    /// \brief Spawn a finer rung from the specified bucket.
+    ///
+    /// \return true if the rung has been spawned; otherwise, false if the
+    ///         bucket events cannot be spread over finer buckets.
+    bool spawnRung(const Rung                &parent,
+                   const uint64_t             index,
+                   std::vector<PendingEvent> &bucket)
+    {
+        const std::size_t count = bucket.size();
+        const timestamp_t width = parent.m_Width / count;
+        const timestamp_t start = parent.m_Start + parent.m_Width * index;
+
+        const auto [min, max] =
+            std::minmax_element(bucket.begin(), bucket.end());
+
+        if (!(width > 0.0) || min->m_Time == max->m_Time)
+            return false;
+
+        Rung &rung = prepareRung(start, width, count + 1);
+
+        for (const PendingEvent &event : bucket)
+            rung.m_Buckets[rung.bucketOf(event.m_Time)].push_back(event);
+
+        bucket.clear();
+        return true;
+    }
+
+    /// \brief Push a new rung in the ladder reusing the previously allocated
+    ///        buckets whenever possible.
+    Rung &prepareRung(const timestamp_t start,
+                      const timestamp_t width,
+                      const uint64_t    bucketCount)
+    {
+        Rung &rung         = m_Rungs[m_RungCount++];
+        rung.m_Start       = start;
+        rung.m_Width       = width;
+        rung.m_BucketCount = bucketCount;
+        rung.m_Current     = 0;
+
+        if (rung.m_Buckets.size() < bucketCount)
+            rung.m_Buckets.resize(bucketCount);
+
+        return rung;
+    }
+
+    std::vector<PendingEvent> m_Top;
+    timestamp_t               m_TopMin   = 0.0;
+    timestamp_t               m_TopMax   = 0.0;
+    timestamp_t               m_TopStart = 0.0;
+
+    std::array<Rung, MaxRungs> m_Rungs{};
+    uint32_t                   m_RungCount = 0;
+
+    std::vector<PendingEvent> m_Bottom;
+    std::size_t               m_BottomHead = 0;
+
+    std::size_t m_Size = 0;
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_LADDER_QUEUE_HPP
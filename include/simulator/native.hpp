@@ -0,0 +1,468 @@
+#ifndef ENGINE_SIMULATOR_NATIVE_HPP
+#define ENGINE_SIMULATOR_NATIVE_HPP
+
+#include <condition_variable>
+#include <core/core.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <simulator/event_set.hpp>
+#include <simulator/ladder_queue.hpp>
+#include <simulator/simulator.hpp>
+#include <vector>
+
+/**
+ * Native Engine Pending Event Set
+ *
+ *  0 - Binary Heap
+ *  1 - Ladder Queue
+ */
+#ifndef NATIVE_EVENT_SET
+#    define NATIVE_EVENT_SET 0
+#endif // NATIVE_EVENT_SET
+
+/// \brief The maximum size (in bytes) of an event content that can be
+///        scheduled in the native engine.
+///
+/// The event content is stored inline in the event slot, therefore, there is
+/// no allocation per scheduled event. Scheduling an event with a content that
+/// is greater than this value aborts the program.
+#define NATIVE_MAX_EVENT_SIZE 128
+
+namespace ispd::sim
+{
+
+#if NATIVE_EVENT_SET == 0
+using NativeEventSet = BinaryHeapEventSet;
+#elif NATIVE_EVENT_SET == 1
+using NativeEventSet = LadderQueueEventSet;
+#else
+#    error "Unknown native engine pending event set."
+#endif // NATIVE_EVENT_SET
+
+/// \struct NativeEventSlot
+///
+/// \brief The storage of a scheduled event in the native engine.
+struct NativeEventSlot
+{
+    sid_t    m_Receiver;
+    unsigned m_Type;
+    unsigned m_Size;
+    alignas(std::max_align_t) unsigned char m_Content[NATIVE_MAX_EVENT_SIZE];
+};
+
+/// \class NativeEventPool
+///
+/// \brief A pool of event slots.
+///
+/// The slots are allocated in fixed-size chunks that are never moved, such
+/// that, a reference to the content of an event being processed remains valid
+/// while the event handler schedules new events. Released slots are recycled
+/// in a last-in first-out order, keeping the recently used slots warm in the
+/// cache.
+class NativeEventPool
+{
+public:
+    /// \brief Acquire a free slot from the pool.
+    ///
+    /// \return The index of the acquired slot.
+    ENGINE_INLINE uint32_t acquire()
+    {
+        if (LIKELY(!m_FreeSlots.empty())) {
+            const uint32_t slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+            return slot;
+        }
+
+        // It checks if all chunks have been used. If so, a new chunk is
+        // allocated to hold the slot.
+        if (UNLIKELY((m_Used >> ChunkShift) == m_Chunks.size()))
+            m_Chunks.emplace_back(new NativeEventSlot[ChunkSize]);
+
+        return m_Used++;
+    }
+
+    /// \brief Release the slot with the specified index back to the pool.
+    ///
+    /// \param slot The index of the slot to be released.
+    ENGINE_INLINE void release(const uint32_t slot)
+    {
+        m_FreeSlots.push_back(slot);
+    }
+
+    /// \brief Returns the slot with the specified index.
+    ENGINE_INLINE NativeEventSlot &operator[](const uint32_t slot)
+    {
+        return m_Chunks[slot >> ChunkShift][slot & (ChunkSize - 1)];
+    }
+
+private:
+    static constexpr uint32_t ChunkShift = 12U;
+    static constexpr uint32_t ChunkSize  = 1U << ChunkShift;
+
+    std::vector<std::unique_ptr<NativeEventSlot[]>> m_Chunks;
+    std::vector<uint32_t>                           m_FreeSlots;
+    uint32_t                                        m_Used = 0U;
+};
+
+/// \brief The increment of the SplitMix64 generator state at each draw.
+constexpr uint64_t SplitMix64Gamma = 0x9E3779B97F4A7C15ULL;
+
+/// \brief Returns a pseudo-random number uniformly distributed in [0, 1)
+///        using the SplitMix64 generator.
+///
+/// \param state The generator state, which is advanced by this call.
+ENGINE_INLINE double drawRandom(uint64_t &state)
+{
+    uint64_t z = (state += SplitMix64Gamma);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z          = z ^ (z >> 31);
+
+    // Use the 53 most significant bits to fill the double's mantissa.
+    return static_cast<double>(z >> 11) * 0x1.0p-53;
+}
+
+/// \brief Rewinds a SplitMix64 generator state by the specified amount of
+///        draws.
+///
+/// Since the SplitMix64 state is a Weyl sequence, the generator is reversed
+/// exactly by subtracting its increment.
+///
+/// \param state The generator state.
+/// \param draws The amount of draws to be reversed.
+ENGINE_INLINE void rewindRandom(uint64_t &state, const uint64_t draws)
+{
+    state -= draws * SplitMix64Gamma;
+}
+
+/// \struct NativeLogicalProcess
+///
+/// \brief The native engine state of a service.
+struct NativeLogicalProcess
+{
+    /// \brief The service's state.
+    Service *m_State;
+
+    /// \brief The service's random stream state.
+    uint64_t m_RandomState;
+
+    /// \brief The amount of events scheduled by the service, which is the
+    ///        sequence number of the next scheduled event.
+    uint64_t m_Sequence;
+
+    /// \brief The kernel (thread) that owns the service.
+    uint32_t m_Owner;
+
+    /// \brief The processing phase of the service.
+    ///
+    /// The sequential engine processes every service in the phase 0. The
+    /// conservative engine processes the services without lookahead in the
+    /// phase 0 and the services with lookahead in the phase 1.
+    uint32_t m_Phase;
+};
+
+/// \struct NativeRemoteEvent
+///
+/// \brief An event scheduled to a service owned by another kernel.
+struct NativeRemoteEvent
+{
+    EventTime       m_Time;
+    uint64_t        m_Sequence;
+    uint32_t        m_Source;
+    NativeEventSlot m_Slot;
+};
+
+/// \class NativeContext
+///
+/// \brief The engine API served to the services by a native engine thread.
+///
+/// Each native engine thread sets its context through \c setCurrentContext,
+/// and the engine functions called by the services (e.g. scheduling events)
+/// are forwarded to it.
+class NativeContext
+{
+public:
+    virtual ~NativeContext() = default;
+
+    /// \brief Schedule an event to be delivered to the specified service.
+    ///
+    /// \param id The receiver service's identifier.
+    /// \param time The timestamp in which the event will be delivered.
+    /// \param eventType The event type.
+    /// \param event The event content.
+    /// \param eventSize The event content size in bytes.
+    virtual void schedule(const sid_t       id,
+                          const timestamp_t time,
+                          const unsigned    eventType,
+                          const void       *event,
+                          const std::size_t eventSize) = 0;
+
+    /// \brief Schedule a batch of events.
+    ///
+    /// By default, the events are scheduled one at a time.
+    ///
+    /// \param events The events to be scheduled.
+    /// \param count The amount of events in the batch.
+    virtual void scheduleBatch(const ispd::ScheduledEvent *events,
+                               const std::size_t           count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+            schedule(events[i].m_Receiver,
+                     events[i].m_Time,
+                     events[i].m_Type,
+                     events[i].m_Content,
+                     events[i].m_Size);
+    }
+
+    /// \brief Returns a pseudo-random number uniformly distributed in [0, 1)
+    ///        drawn from the random stream of the service being processed.
+    virtual double random() = 0;
+
+    /// \brief Returns the reverse data storage of the event being processed.
+    virtual void *getReverseData() = 0;
+
+    /// \brief Set the service being currently processed.
+    ///
+    /// This is used while the services are being initialized, such that,
+    /// the events and random numbers are attributed to the correct service.
+    virtual void setCurrent(const sid_t id) = 0;
+};
+
+/// \class NativeKernel
+///
+/// \brief The event processing kernel of the native engines.
+///
+/// \details
+///        A kernel holds the pending events of the services it owns and
+///        processes them in non-decreasing timestamp order. The sequential
+///        engine has a single kernel owning all services, while the
+///        conservative engine has one kernel per thread.
+///
+///        Events scheduled to services owned by another kernel are buffered
+///        in the kernel's outboxes, which are delivered by the engine at the
+///        synchronization points.
+class NativeKernel final : public NativeContext
+{
+public:
+    /// \brief NativeKernel ctor.
+    ///
+    /// \param id The kernel identifier.
+    /// \param kernels The amount of kernels in the engine.
+    /// \param lps The logical processes shared by all kernels.
+    explicit NativeKernel(const uint32_t                     id,
+                          const uint32_t                     kernels,
+                          std::vector<NativeLogicalProcess> &lps)
+        : m_Id(id), m_Lps(lps), m_Outboxes(kernels)
+    {
+        for (sid_t sid = 0; sid < lps.size(); sid++)
+            if (lps[sid].m_Owner == id)
+                m_Owned.push_back(sid);
+    }
+
+    void schedule(const sid_t       id,
+                  const timestamp_t time,
+                  const unsigned    eventType,
+                  const void       *event,
+                  const std::size_t eventSize) override
+    {
+        post(id, time, eventType, event, eventSize, false);
+    }
+
+    /// \brief Schedule a batch of events, inserting them in the pending event
+    ///        sets in bulk.
+    void scheduleBatch(const ispd::ScheduledEvent *events,
+                       const std::size_t           count) override;
+
+    double random() override;
+
+    /// \brief Returns a scratch storage, since the events processed by this
+    ///        kernel are never reversed.
+    void *getReverseData() override
+    {
+        return m_ReverseData;
+    }
+
+    void setCurrent(const sid_t id) override
+    {
+        m_Current = id;
+    }
+
+    /// \brief Process the pending events of the specified phase whose
+    ///        timestamps are less than the specified end.
+    ///
+    /// \param phase The phase of the services whose events are processed.
+    /// \param end The (exclusive) upper bound of the processed timestamps.
+    void process(const uint32_t phase, const timestamp_t end);
+
+    /// \brief Deliver the events buffered to this kernel in the outboxes of
+    ///        every kernel.
+    ///
+    /// \param kernels The engine's kernels.
+    void deliver(std::vector<std::unique_ptr<NativeKernel>> &kernels);
+
+    /// \brief Move the buffered events to the outboxes of their receivers'
+    ///        current owners, after the services have been repartitioned.
+    void redirect();
+
+    /// \brief Returns the least timestamp among the pending events, or the
+    ///        greatest timestamp if there is no pending event.
+    timestamp_t getNextTime();
+
+    /// \brief Returns the amount of events that have been processed.
+    ENGINE_INLINE uint64_t getProcessedEvents() const
+    {
+        return m_ProcessedEvents;
+    }
+
+    /// \brief Returns true if every service owned by this kernel is
+    ///        quiescent (see \c Service::isQuiescent).
+    bool isQuiescent() const;
+
+private:
+    /// \brief Dispatch the event stored in the specified slot to its
+    ///        receiver service.
+    void dispatch(const timestamp_t now, const NativeEventSlot &slot);
+
+    /// \brief Schedule an event to be delivered to the specified service.
+    ///
+    /// \param bulk If true, the event is inserted in its pending event set as
+    ///             part of a bulk insertion.
+    void post(const sid_t       id,
+              const timestamp_t time,
+              const unsigned    eventType,
+              const void       *event,
+              const std::size_t eventSize,
+              const bool        bulk);
+
+    /// \brief Insert an event in the pending event set of its receiver's
+    ///        phase.
+    void enqueue(const PendingEvent &event, const bool bulk);
+
+    /// \brief It checks if an event scheduled to a service owned by another
+    ///        kernel, or in another phase, would be processed out of order.
+    void checkWindow(const sid_t               id,
+                     const timestamp_t         time,
+                     const NativeLogicalProcess &receiver) const;
+
+    uint32_t                                     m_Id;
+    std::vector<NativeLogicalProcess>           &m_Lps;
+    std::vector<sid_t>                           m_Owned;
+    std::vector<std::vector<NativeRemoteEvent>>  m_Outboxes;
+    NativeEventPool                              m_Pool;
+    NativeEventSet                               m_PendingEvents[2];
+    uint32_t                                     m_Phase           = 0;
+    timestamp_t                                  m_WindowEnd       = 0.0;
+    timestamp_t                                  m_Now             = 0.0;
+    sid_t                                        m_Current         = 0;
+    uint64_t                                     m_ProcessedEvents = 0ULL;
+
+    alignas(std::max_align_t) unsigned char
+        m_ReverseData[ENGINE_MAX_REVERSE_DATA_SIZE];
+};
+
+/// \class NativeBarrier
+///
+/// \brief A reusable thread barrier that computes the minimum among the
+///        values contributed by the threads.
+///
+/// The barrier is used by the parallel native engines both as a
+/// synchronization point and to compute global values, such as the least
+/// timestamp among all pending events.
+class NativeBarrier
+{
+public:
+    /// \brief NativeBarrier ctor.
+    ///
+    /// \param threads The amount of threads that synchronize in the barrier.
+    explicit NativeBarrier(const uint32_t threads) : m_Threads(threads)
+    {}
+
+    /// \brief Wait until all threads have arrived at the barrier.
+    ///
+    /// \param value The value contributed by the calling thread.
+    ///
+    /// \return The minimum value contributed by the threads.
+    timestamp_t wait(const timestamp_t value);
+
+private:
+    std::mutex              m_Mutex;
+    std::condition_variable m_Condition;
+    uint32_t                m_Threads;
+    uint32_t                m_Arrived    = 0;
+    uint64_t                m_Generation = 0;
+    timestamp_t             m_Min;
+    timestamp_t             m_Result;
+};
+
+/// \brief Sets the context that serves the engine API in the calling thread.
+///
+/// \param context The context, or nullptr after the simulation has finished.
+void setCurrentContext(NativeContext *context);
+
+/// \brief Partitions the services among the threads.
+///
+/// The services are partitioned in contiguous blocks of identifiers, since
+/// the model builders register the services of a topology level in sequence.
+///
+/// \param lps The services' native engine state, whose owners are set.
+/// \param threads The requested amount of threads. If zero, the amount of
+///                hardware threads is used.
+///
+/// \return The amount of threads, which is never greater than the amount of
+///         services, such that, every thread owns at least one service.
+uint32_t partitionServices(std::vector<NativeLogicalProcess> &lps,
+                           uint32_t                           threads);
+
+/// \brief Initializes the services' native engine state and calls the
+///        registered service initializers in the services' identifiers order.
+///
+/// \param simulator The simulator in which the services have been registered.
+/// \param lps The services' native engine state, whose owners must have been
+///            already set.
+/// \param context The context that serves the engine API while each service
+///                is initialized.
+/// \param seed The seed used to initialize the services' random streams.
+void initializeServices(Simulator                         &simulator,
+                        std::vector<NativeLogicalProcess> &lps,
+                        NativeContext                     &context,
+                        const uint64_t                     seed);
+
+/// \brief Calls the registered service finalizers in the services'
+///        identifiers order.
+void finalizeServices(Simulator                               &simulator,
+                      const std::vector<NativeLogicalProcess> &lps);
+
+/// \class NativeSimulator
+///
+/// \brief Native sequential simulator class.
+///
+/// \details
+///        This class implements an in-tree sequential discrete-event
+///        simulation engine. Events are kept in a pending event set and are
+///        processed in non-decreasing timestamp order by a plain event loop,
+///        therefore, there is neither checkpointing nor rollback bookkeeping.
+///
+///        The services are dispatched exactly as in the \c ROOTSimSimulator,
+///        such that, the same model may be simulated by both engines.
+class NativeSimulator : public Simulator
+{
+public:
+    /// \brief NativeSimulator ctor.
+    ///
+    /// \param seed The seed used to initialize the services' random streams.
+    explicit NativeSimulator(const uint64_t seed) : m_Seed(seed)
+    {}
+
+    /// \brief It executes the simulation sequentially until there are no
+    ///        more pending events.
+    void simulate() override;
+
+private:
+    uint64_t m_Seed;
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_NATIVE_HPP
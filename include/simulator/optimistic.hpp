@@ -0,0 +1,275 @@
+#ifndef ENGINE_SIMULATOR_OPTIMISTIC_HPP
+#define ENGINE_SIMULATOR_OPTIMISTIC_HPP
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <simulator/native.hpp>
+#include <simulator/simulator.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace ispd::sim
+{
+
+/// \struct OptimisticMessage
+///
+/// \brief An event, or an anti-event, sent to a service owned by another
+///        kernel.
+struct OptimisticMessage
+{
+    EventTime       m_Time;
+    uint64_t        m_Sequence;
+    uint32_t        m_Source;
+    uint64_t        m_Id;
+    bool            m_Anti;
+    NativeEventSlot m_Slot;
+};
+
+/// \struct ProcessedEvent
+///
+/// \brief An event that has been processed, but not committed yet.
+///
+/// The processed event keeps everything that is necessary to reverse it: the
+/// event itself, the data saved by the forward handler, the amount of random
+/// numbers drawn and the amount of events that have been scheduled.
+struct ProcessedEvent
+{
+    PendingEvent m_Event;
+    uint32_t     m_RandomDraws;
+    uint32_t     m_SentEvents;
+    alignas(std::max_align_t) unsigned char
+        m_ReverseData[ENGINE_MAX_REVERSE_DATA_SIZE];
+};
+
+/// \struct SentEvent
+///
+/// \brief An event scheduled while processing an event that has not been
+///        committed yet.
+struct SentEvent
+{
+    uint64_t m_Id;
+    sid_t    m_Receiver;
+};
+
+/// \struct OptimisticHistory
+///
+/// \brief The uncommitted processing history of a service.
+struct OptimisticHistory
+{
+    /// \brief The processed events in their processing order.
+    std::deque<ProcessedEvent> m_ProcessedEvents;
+
+    /// \brief The events scheduled by the processed events in their
+    ///        scheduling order.
+    std::deque<SentEvent> m_SentEvents;
+};
+
+/// \class OptimisticKernel
+///
+/// \brief The event processing kernel of the native optimistic engine.
+///
+/// \details
+///        A kernel processes the pending events of the services it owns in
+///        non-decreasing timestamp order, without waiting for the other
+///        kernels. If an event (a straggler) is received with a timestamp
+///        that is less than the timestamp of an event already processed by
+///        its receiver, the receiver is rolled back by calling the reverse
+///        handlers of the processed events in the reverse processing order.
+///        The events scheduled by the reversed events are annihilated by
+///        anti-events.
+///
+///        Since the services' states are restored by reverse computation,
+///        there is no checkpointing.
+class OptimisticKernel final : public NativeContext
+{
+public:
+    /// \brief OptimisticKernel ctor.
+    ///
+    /// \param id The kernel identifier.
+    /// \param kernels The amount of kernels in the engine.
+    /// \param lps The logical processes shared by all kernels.
+    /// \param histories The services' histories shared by all kernels.
+    explicit OptimisticKernel(const uint32_t                     id,
+                              const uint32_t                     kernels,
+                              std::vector<NativeLogicalProcess> &lps,
+                              std::vector<OptimisticHistory>    &histories);
+
+    void schedule(const sid_t       id,
+                  const timestamp_t time,
+                  const unsigned    eventType,
+                  const void       *event,
+                  const std::size_t eventSize) override;
+
+    double random() override;
+
+    void *getReverseData() override
+    {
+        return m_ReverseData;
+    }
+
+    void setCurrent(const sid_t id) override
+    {
+        m_Current = id;
+    }
+
+    /// \brief Process at most the specified amount of pending events.
+    ///
+    /// \param batch The maximum amount of events to be processed.
+    void process(const uint32_t batch);
+
+    /// \brief Deliver the messages sent to this kernel by every kernel since
+    ///        the last delivery.
+    ///
+    /// \param kernels The engine's kernels.
+    ///
+    /// \return true if the delivery has sent new messages (anti-events due to
+    ///         rollbacks) to other kernels.
+    bool deliver(std::vector<std::unique_ptr<OptimisticKernel>> &kernels);
+
+    /// \brief Returns the least timestamp among the pending events, or the
+    ///        greatest timestamp if there is no pending event.
+    timestamp_t getNextTime();
+
+    /// \brief Commit the processed events whose timestamps are less than the
+    ///        specified global virtual time.
+    ///
+    /// \param gvt The global virtual time.
+    void commit(const timestamp_t gvt);
+
+    /// \brief Returns true if every service owned by this kernel is
+    ///        quiescent in its committed state.
+    ///
+    /// The state of a service that has processed uncommitted events may
+    /// still be rolled back, therefore, such service is never considered
+    /// quiescent.
+    bool isQuiescent() const;
+
+    /// \brief Returns the amount of events that have been rolled back.
+    ENGINE_INLINE uint64_t getRolledBackEvents() const
+    {
+        return m_RolledBackEvents;
+    }
+
+    /// \brief Returns the amount of events that have been committed.
+    ENGINE_INLINE uint64_t getCommittedEvents() const
+    {
+        return m_CommittedEvents;
+    }
+
+private:
+    /// \brief The state of a slot holding an event owned by this kernel.
+    enum class SlotState : uint8_t
+    {
+        PENDING,
+        PROCESSED,
+        CANCELLED
+    };
+
+    /// \brief The bookkeeping of a slot holding an event owned by this kernel.
+    struct SlotInfo
+    {
+        uint64_t     m_Id;
+        PendingEvent m_Event;
+        SlotState    m_State;
+    };
+
+    /// \brief Insert an event in the pending event set, rolling back its
+    ///        receiver if the event is a straggler.
+    void enqueue(const PendingEvent &event, const uint64_t id);
+
+    /// \brief Roll back the specified service until the specified event.
+    ///
+    /// \param id The service's identifier.
+    /// \param until Every processed event that is not less than this event
+    ///              is reversed.
+    /// \param annihilate If true, the \c until event is annihilated instead
+    ///                   of being inserted back in the pending event set.
+    void rollback(const sid_t id, const PendingEvent &until, bool annihilate);
+
+    /// \brief Annihilate the event with the specified identifier.
+    void cancel(const SentEvent &sent);
+
+    /// \brief Annihilate the events scheduled by reversed events.
+    void drainCancellations();
+
+    /// \brief Dispatch the event stored in the specified slot to its
+    ///        receiver service's forward or reverse handler.
+    void dispatch(const timestamp_t      now,
+                  const NativeEventSlot &slot,
+                  const bool             reverse);
+
+    uint32_t                           m_Id;
+    std::vector<NativeLogicalProcess> &m_Lps;
+    std::vector<OptimisticHistory>    &m_Histories;
+    std::vector<sid_t>                 m_Owned;
+
+    /// \brief The outboxes are double buffered, such that, the anti-events
+    ///        sent while the messages are being delivered do not race with
+    ///        the delivery.
+    std::vector<std::vector<OptimisticMessage>> m_Outboxes[2];
+    uint32_t                                    m_Buffer = 0;
+
+    NativeEventPool                        m_Pool;
+    NativeEventSet                         m_PendingEvents;
+    std::vector<SlotInfo>                  m_Slots;
+    std::unordered_map<uint64_t, uint32_t> m_Events;
+    std::vector<SentEvent>                 m_Cancellations;
+
+    ProcessedEvent *m_Record = nullptr;
+    unsigned char  *m_ReverseData;
+    timestamp_t     m_Now              = 0.0;
+    sid_t           m_Current          = 0;
+    uint64_t        m_NextId           = 0ULL;
+    uint64_t        m_RolledBackEvents = 0ULL;
+    uint64_t        m_CommittedEvents  = 0ULL;
+
+    alignas(std::max_align_t) unsigned char
+        m_Scratch[ENGINE_MAX_REVERSE_DATA_SIZE];
+};
+
+/// \class OptimisticSimulator
+///
+/// \brief Native optimistic simulator class.
+///
+/// \details
+///        This class implements a multi-threaded Time Warp engine that rolls
+///        back the services by reverse computation. The services are
+///        partitioned among the threads, and each thread processes a batch
+///        of events optimistically. Then, the threads synchronize to exchange
+///        the events sent to each other, which may cause rollbacks, and to
+///        compute the global virtual time (GVT), before which the processed
+///        events are committed.
+///
+///        Every service must support reverse computation (see
+///        \c Service::isReversible); otherwise, the program is aborted before
+///        the simulation starts.
+class OptimisticSimulator : public Simulator
+{
+public:
+    /// \brief OptimisticSimulator ctor.
+    ///
+    /// \param threads The amount of threads. If zero, the amount of hardware
+    ///                threads is used.
+    /// \param batch The amount of events processed by each thread between
+    ///              two synchronizations.
+    /// \param seed The seed used to initialize the services' random streams.
+    explicit OptimisticSimulator(const uint32_t threads,
+                                 const uint32_t batch,
+                                 const uint64_t seed)
+        : m_Threads(threads), m_Batch(batch), m_Seed(seed)
+    {}
+
+    /// \brief It executes the simulation optimistically until there are no
+    ///        more pending events.
+    void simulate() override;
+
+private:
+    uint32_t m_Threads;
+    uint32_t m_Batch;
+    uint64_t m_Seed;
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_OPTIMISTIC_HPP
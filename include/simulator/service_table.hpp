@@ -0,0 +1,242 @@
+#ifndef ENGINE_SIMULATOR_SERVICE_TABLE_HPP
+#define ENGINE_SIMULATOR_SERVICE_TABLE_HPP
+
+#include <core/core.hpp>
+#include <cstdint>
+#include <functional>
+#include <service/core_scheduler.hpp>
+#include <service/link.hpp>
+#include <service/service.hpp>
+#include <vector>
+
+namespace ispd::sim
+{
+
+/// \class ServiceTable
+///
+/// \brief A dense, identifier-addressed table of service initializers and
+///        finalizers.
+///
+/// Each service identifier addresses an entry that holds the kind of its
+/// initializer and the index of its parameters. The parameters of the
+/// built-in services are stored in typed tables, one array per parameter,
+/// such that, registering a service is a handful of appends with no hashing
+/// and no allocation per service. The services that are not built-in are
+/// registered through a generic initializer function.
+///
+/// The services' identifiers are expected to be dense, that is, in the
+/// interval [0, n), where n is the amount of registered services.
+class ServiceTable
+{
+public:
+    /// \brief Register a generic service initializer for a service with the
+    ///        specified identifier.
+    ///
+    /// \param serviceId The identifier of the service.
+    /// \param serviceInitializer The function that represents the service
+    ///                           initializer.
+    ///
+    /// \note If a service with the same \c serviceId has already been
+    ///       registered, the program will abort.
+    void registerService(const sid_t                       serviceId,
+                         const std::function<Service *()> &serviceInitializer);
+
+    /// \brief Register a machine with the specified identifier and
+    ///        parameters.
+    void registerMachine(
+        const sid_t         machineId,
+        const double        power,
+        const double        loadFactor,
+        const int           cores,
+        const CoreSelection selection = CoreSelection::AUTOMATIC);
+
+    /// \brief Register a processor-sharing machine with the specified
+    ///        identifier and parameters.
+    ///
+    /// The processor-sharing machines' parameters are stored in the same
+    /// table as the machines' ones.
+    void registerSharingMachine(const sid_t  machineId,
+                                const double power,
+                                const double loadFactor,
+                                const int    cores);
+
+    /// \brief Register a link with the specified identifier and parameters.
+    void registerLink(const sid_t      linkId,
+                      const sid_t      from,
+                      const sid_t      to,
+                      const double     bandwidth,
+                      const double     loadFactor,
+                      const double     latency,
+                      const LinkDuplex duplex = LinkDuplex::HALF);
+
+    /// \brief Register a switch with the specified identifier and parameters.
+    void registerSwitch(const sid_t  switchId,
+                        const double bandwidth,
+                        const double loadFactor,
+                        const double latency);
+
+    /// \brief Register a cluster with the specified identifier and
+    ///        parameters, which are the same for each of its machines and
+    ///        each of their access links.
+    void registerCluster(const sid_t    clusterId,
+                         const uint32_t machines,
+                         const double   power,
+                         const double   loadFactor,
+                         const int      cores,
+                         const double   linkBandwidth,
+                         const double   linkLoadFactor,
+                         const double   linkLatency);
+
+    /// \brief Register a dummy service with the specified identifier.
+    void registerDummy(const sid_t dummyId);
+
+    /// \brief Register a service finalizer for a service with the specified
+    ///        identifier.
+    ///
+    /// \param serviceId The identifier of the service.
+    /// \param serviceFinalizer The function that represents the service
+    ///                         finalizer.
+    ///
+    /// \note If a service finalizer with the same \c serviceId has already
+    ///       been registered, the program will abort.
+    void registerServiceFinalizer(
+        const sid_t                           serviceId,
+        const std::function<void(Service *)> &serviceFinalizer);
+
+    /// \brief Construct the service with the specified identifier.
+    ///
+    /// \note If no service has been registered with the specified identifier,
+    ///       or if the service constructed has another identifier, the
+    ///       program will abort.
+    ///
+    /// \return The constructed service.
+    Service *initialize(const sid_t serviceId) const;
+
+    /// \brief Call the service finalizer of the specified service, if one has
+    ///        been registered.
+    ///
+    /// Unlikely the service initializer, there is no strict requirement for
+    /// all services to have a service finalizer.
+    void finalize(const sid_t serviceId, Service *service) const;
+
+    /// \brief Returns the kind of the service with the specified identifier.
+    ///
+    /// The services registered through a generic service initializer, which
+    /// includes the masters, are of the \c USER kind.
+    ///
+    /// \note If no service has been registered with the specified identifier,
+    ///       the program will abort.
+    ServiceKind getKind(const sid_t serviceId) const;
+
+    /// \brief Calls the specified function for each registered link, in the
+    ///        links' identifiers order.
+    ///
+    /// \param function The function, which is called with the link's
+    ///                 identifier, source, destination, bandwidth and latency.
+    template <typename Function>
+    void forEachLink(Function &&function) const
+    {
+        for (sid_t id = 0; id < m_Entries.size(); id++) {
+            if (m_Entries[id].m_Kind != Initializer::LINK)
+                continue;
+
+            const uint32_t i = m_Entries[id].m_Index;
+            function(id,
+                     m_Links.m_From[i],
+                     m_Links.m_To[i],
+                     m_Links.m_Bandwidth[i],
+                     m_Links.m_Latency[i]);
+        }
+    }
+
+    /// \brief Returns the amount of services, that is, one more than the
+    ///        greatest registered service identifier.
+    ENGINE_INLINE sid_t size() const
+    {
+        return m_Entries.size();
+    }
+
+private:
+    /// \brief The kind of initializer of a service.
+    enum class Initializer : uint8_t
+    {
+        NONE,
+        GENERIC,
+        MACHINE,
+        LINK,
+        SWITCH,
+        DUMMY,
+        CLUSTER,
+        SHARING_MACHINE
+    };
+
+    /// \brief The entry of a service, which holds the kind of its initializer
+    ///        and the index of its parameters in the respective table.
+    struct Entry
+    {
+        uint32_t    m_Index;
+        Initializer m_Kind;
+    };
+
+    /// \brief The indicator of a service with no service finalizer.
+    static constexpr uint32_t NoFinalizer = UINT32_MAX;
+
+    /// \brief Insert the entry of the specified service.
+    ///
+    /// \param index The index of the service's parameters, which is the size
+    ///              of the respective table before the insertion.
+    void insert(const sid_t       serviceId,
+                const Initializer kind,
+                const std::size_t index);
+
+    std::vector<Entry> m_Entries{};
+
+    std::vector<std::function<Service *()>> m_Generic{};
+
+    struct
+    {
+        std::vector<double> m_Power;
+        std::vector<double> m_LoadFactor;
+        std::vector<int>    m_Cores;
+
+        std::vector<CoreSelection> m_CoreSelection;
+    } m_Machines{};
+
+    struct
+    {
+        std::vector<sid_t>  m_From;
+        std::vector<sid_t>  m_To;
+        std::vector<double> m_Bandwidth;
+        std::vector<double> m_LoadFactor;
+        std::vector<double> m_Latency;
+
+        std::vector<LinkDuplex> m_Duplex;
+    } m_Links{};
+
+    struct
+    {
+        std::vector<double> m_Bandwidth;
+        std::vector<double> m_LoadFactor;
+        std::vector<double> m_Latency;
+    } m_Switches{};
+
+    struct
+    {
+        std::vector<uint32_t> m_Machines;
+        std::vector<double>   m_Power;
+        std::vector<double>   m_LoadFactor;
+        std::vector<int>      m_Cores;
+        std::vector<double>   m_LinkBandwidth;
+        std::vector<double>   m_LinkLoadFactor;
+        std::vector<double>   m_LinkLatency;
+    } m_Clusters{};
+
+    /// \brief The index of the service finalizer of each service, or
+    ///        \c NoFinalizer if the service has no service finalizer.
+    std::vector<uint32_t>                       m_FinalizerIndices{};
+    std::vector<std::function<void(Service *)>> m_Finalizers{};
+};
+
+} // namespace ispd::sim
+
+#endif // ENGINE_SIMULATOR_SERVICE_TABLE_HPP
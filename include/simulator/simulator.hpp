@@ -5,7 +5,7 @@
 #include <functional>
 #include <memory>
 #include <service/service.hpp>
-#include <unordered_map>
+#include <simulator/service_table.hpp>
 
 namespace ispd::sim
 {
@@ -49,9 +49,14 @@ enum class SimulationMode
 /// - ROOTSIM: Represents the root simulator type. This can be the main
 ///            simulator or the top-level simulator used for running the
 ///            simulation.
+///
+/// - NATIVE: Represents the in-tree simulator type. It progresses the
+///           simulation with its own pending event set, without relying on
+///           any external simulation library.
 enum class SimulatorType
 {
-    ROOTSIM
+    ROOTSIM,
+    NATIVE
 };
 
 /// \class Simulator
@@ -85,16 +90,7 @@ public:
         const sid_t                       serviceId,
         const std::function<Service *()> &serviceInitializer)
     {
-        // It checks if a service initializer with that id has already been
-        // registered. If so, then the program is immediately aborted.
-        if (m_ServiceInitializers.find(serviceId) !=
-            m_ServiceInitializers.end())
-            die("A service with id %lu has already been registered.",
-                serviceId);
-
-        // Register the service.
-        m_ServiceInitializers.insert(
-            std::make_pair(serviceId, serviceInitializer));
+        m_Services.registerService(serviceId, serviceInitializer);
     }
 
     /// \brief Register a service finalizer for a service with the specified
@@ -116,65 +112,39 @@ public:
         const sid_t                           serviceId,
         const std::function<void(Service *)> &serviceFinalizer)
     {
-        // It checks if a service finalizer with that id has already been
-        // registered. If so, then the program is immediately aborted.
-        if (m_ServiceFinalizers.find(serviceId) != m_ServiceFinalizers.end())
-            die("A service with id %lu has already been registered.",
-                serviceId);
-
-        // Register the service finalizer.
-        m_ServiceFinalizers.insert(std::make_pair(serviceId, serviceFinalizer));
+        m_Services.registerServiceFinalizer(serviceId, serviceFinalizer);
     }
 
     /// \brief Execute the simulation.
     virtual void simulate() = 0;
 
-    /// \brief Get a const (read-only) reference to the map of service
-    ///        initializers.
+    /// \brief Get a reference to the table of service initializers and
+    ///        finalizers.
     ///
-    /// This function returns a const (read-only) reference to the map of
-    /// service initializers, which contains the registered service initializers
-    /// for different service identifiers.
+    /// The table is used to register the built-in services without a service
+    /// initializer function per service.
     ///
-    /// \return A const (read-only) reference to the map of service
-    ///         initializers.
-    ENGINE_INLINE const std::unordered_map<sid_t, std::function<Service *()>>                     &
-    getServices()
+    /// \return A reference to the table of service initializers and
+    ///         finalizers.
+    ENGINE_INLINE ServiceTable &getServiceTable()
     {
-        return m_ServiceInitializers;
+        return m_Services;
     }
 
-    /// \brief Get a const (read-only) reference to the map of service
-    ///        finalizers.
+    /// \brief Get a const (read-only) reference to the table of service
+    ///        initializers and finalizers.
     ///
-    /// This function returns a const (read-only) reference to the map of
-    /// service finalizers, which contains the registered service finalizers for
-    /// different service identifiers.
-    ///
-    /// \return A const (read-only) reference to the map of service finalizers.
-    ENGINE_INLINE const std::unordered_map<sid_t,
-                                           std::function<void(Service *)>>                     &
-    getServicesFinalizers()
+    /// \return A const (read-only) reference to the table of service
+    ///         initializers and finalizers.
+    ENGINE_INLINE const ServiceTable &getServiceTable() const
     {
-        return m_ServiceFinalizers;
+        return m_Services;
     }
 
 protected:
-    /// \brief It contains code sections that will be called when a service with
-    ///        the respective identifier is initialized.
-    ///
-    /// These code sections represent parameterized functions that is registered
-    /// by the user to customize the service's initialization behavior.
-    std::unordered_map<sid_t, std::function<Service *()>>
-        m_ServiceInitializers{};
-
-    /// \brief It contains code sections that will be called when a service with
-    ///        the respective identifier is finalized.
-    ///
-    /// These code sections represent parameterized functions that is registered
-    /// by the user to customize the service's finalization behavior.
-    std::unordered_map<sid_t, std::function<void(Service *)>>
-        m_ServiceFinalizers{};
+    /// \brief It contains the service initializers and finalizers registered
+    ///        for each service identifier.
+    ServiceTable m_Services{};
 };
 
 /// \class SimulatorBuilder
@@ -224,7 +194,7 @@ public:
     /// The constructed SimulatorBuilder object can then be used to configure
     /// and build the simulator for the specified engine and mode.
     ///
-    /// \param type The underlying simulator type, such as ROOTSIM.
+    /// \param type The underlying simulator type, such as ROOTSIM or NATIVE.
     /// \param mode The simulation mode, such as SEQUENTIAL, OPTIMISTIC, or
     ///             CONSERVATIVE.
     explicit SimulatorBuilder(const SimulatorType  type,
@@ -4,6 +4,7 @@
 #include <ROOT-Sim.h>
 #include <core/core.hpp>
 #include <customer/customer.hpp>
+#include <engine.hpp>
 
 /// \class Workload
 ///
@@ -40,13 +41,24 @@ public:
     virtual void setTaskWorkload(double &processingSize,
                                  double &communicationSize) = 0;
 
+    /// \brief Reverses the last task taken from the workload.
+    ///
+    /// The `setTaskWorkloadReverse` function gives back the last task that has
+    /// been taken by `setTaskWorkload`. The random numbers drawn to generate
+    /// the task sizes are reversed by the engine, therefore, only the
+    /// remaining tasks count has to be restored.
+    ENGINE_INLINE void setTaskWorkloadReverse()
+    {
+        m_TaskAmount++;
+    }
+
     /// \brief Retrieves the number of remaining tasks in the workload.
     ///
     /// The `getRemainingTasks` function returns the number of tasks that are
     /// yet to be processed or executed in the workload.
     ///
     /// \return The number of remaining tasks in the workload.
-    ENGINE_INLINE int getRemainingTasks()
+    ENGINE_INLINE int getRemainingTasks() const
     {
         return m_TaskAmount;
     }
@@ -61,7 +73,7 @@ public:
     ///
     /// \return `true` if there are remaining tasks in the workload, `false`
     ///         otherwise.
-    ENGINE_INLINE bool hasRemainingWorkload()
+    ENGINE_INLINE bool hasRemainingWorkload() const
     {
         return m_TaskAmount > 0;
     }
@@ -216,10 +228,11 @@ public:
                          double &communicationSize) override
     {
         processingSize =
-            Random() * (m_MaxProcessingSize - m_MinProcessingSize) +
+            ispd::random() * (m_MaxProcessingSize - m_MinProcessingSize) +
             m_MinProcessingSize;
         communicationSize =
-            Random() * (m_MaxCommunicationSize - m_MinCommunicationSize) +
+            ispd::random() *
+                (m_MaxCommunicationSize - m_MinCommunicationSize) +
             m_MinCommunicationSize;
         m_TaskAmount--;
     }
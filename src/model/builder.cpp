@@ -1,15 +1,16 @@
+#include <algorithm>
 #include <allocator/rootsim_allocator.hpp>
 #include <chrono>
+#include <cmath>
 #include <core/core.hpp>
 #include <customer/customer.hpp>
 #include <functional>
+#include <limits>
 #include <math/utility.hpp>
 #include <model/builder.hpp>
 #include <random>
-#include <service/dummy.hpp>
-#include <service/link.hpp>
-#include <service/machine.hpp>
-#include <service/switch.hpp>
+#include <service/cluster.hpp>
+#include <vector>
 
 
 void ispd::model::Builder::registerMaster(
@@ -39,10 +40,11 @@ void ispd::model::Builder::registerMaster(
         });
 }
 
-void ispd::model::Builder::registerMachine(const sid_t  machineId,
-                                           const double power,
-                                           const double loadFactor,
-                                           const int    cores)
+void ispd::model::Builder::registerMachine(const sid_t         machineId,
+                                           const double        power,
+                                           const double        loadFactor,
+                                           const int           cores,
+                                           const CoreSelection selection)
 {
     // It checks if the power specified is non-positive. If so,
     // the program will be immediately aborted.
@@ -60,18 +62,42 @@ void ispd::model::Builder::registerMachine(const sid_t  machineId,
             machineId,
             loadFactor);
 
-    m_Simulator->registerService(
-        machineId, [machineId, power, loadFactor, cores]() {
-            return ROOTSimAllocator<>::construct<Machine>(
-                machineId, power, loadFactor, cores);
-        });
+    m_Simulator->getServiceTable().registerMachine(
+        machineId, power, loadFactor, cores, selection);
 }
-void ispd::model::Builder::registerLink(const sid_t  linkId,
-                                        const sid_t  from,
-                                        const sid_t  to,
-                                        const double bandwidth,
-                                        const double loadFactor,
-                                        const double latency)
+
+void ispd::model::Builder::registerSharingMachine(const sid_t  machineId,
+                                                  const double power,
+                                                  const double loadFactor,
+                                                  const int    cores)
+{
+    // It checks if the power specified is non-positive. If so,
+    // the program will be immediately aborted.
+    if (UNLIKELY(power <= 0.0))
+        die("Registering the machine %llu we encountered that the power is "
+            "non-positive (%lf).",
+            machineId,
+            power);
+
+    // It checks if the load factor is out of the interval [0, 1]. If so,
+    // the program will be immediately aborted.
+    if (UNLIKELY(loadFactor < 0.0 || loadFactor > 1.0))
+        die("Registering the machine %llu we encountered that the load factor "
+            "(%lf) is out of the interval [0, 1].",
+            machineId,
+            loadFactor);
+
+    m_Simulator->getServiceTable().registerSharingMachine(
+        machineId, power, loadFactor, cores);
+}
+
+void ispd::model::Builder::registerLink(const sid_t      linkId,
+                                        const sid_t      from,
+                                        const sid_t      to,
+                                        const double     bandwidth,
+                                        const double     loadFactor,
+                                        const double     latency,
+                                        const LinkDuplex duplex)
 {
 
     // It checks if the load factor is out of the interval [0, 1]. If so,
@@ -82,11 +108,8 @@ void ispd::model::Builder::registerLink(const sid_t  linkId,
             linkId,
             loadFactor);
 
-    m_Simulator->registerService(
-        linkId, [linkId, from, to, bandwidth, loadFactor, latency]() {
-            return ROOTSimAllocator<>::construct<Link>(
-                linkId, from, to, bandwidth, loadFactor, latency);
-        });
+    m_Simulator->getServiceTable().registerLink(
+        linkId, from, to, bandwidth, loadFactor, latency, duplex);
 }
 
 void ispd::model::Builder::registerSwitch(const sid_t switchId,
@@ -100,22 +123,130 @@ void ispd::model::Builder::registerSwitch(const sid_t switchId,
         die("Registering the switch %llu we encountered that the load factor "
             "(%lf) is out of the interval [0, 1].", switchId, loadFactor);
 
-    m_Simulator->registerService(
-        switchId, [switchId, bandwidth, loadFactor, latency]() {
-            return ROOTSimAllocator<>::construct<Switch>(
-                switchId, bandwidth, loadFactor, latency);
-        });
+    m_Simulator->getServiceTable().registerSwitch(
+        switchId, bandwidth, loadFactor, latency);
+}
+
+void ispd::model::Builder::registerCluster(const sid_t    clusterId,
+                                           const uint32_t machines,
+                                           const double   power,
+                                           const double   loadFactor,
+                                           const int      cores,
+                                           const double   linkBandwidth,
+                                           const double   linkLoadFactor,
+                                           const double   linkLatency)
+{
+    // It checks if the amount of machines does not fit in the tasks. If so,
+    // the program will be immediately aborted.
+    if (UNLIKELY(machines == 0U || machines > ClusterMaxMachines))
+        die("Registering the cluster %llu we encountered that the amount of "
+            "machines (%u) is out of the interval [1, %u].",
+            clusterId,
+            machines,
+            ClusterMaxMachines);
+
+    // It checks if the power specified is non-positive. If so,
+    // the program will be immediately aborted.
+    if (UNLIKELY(power <= 0.0))
+        die("Registering the cluster %llu we encountered that the power is "
+            "non-positive (%lf).",
+            clusterId,
+            power);
+
+    // It checks if any load factor is out of the interval [0, 1]. If so,
+    // the program will be immediately aborted.
+    if (UNLIKELY(loadFactor < 0.0 || loadFactor > 1.0))
+        die("Registering the cluster %llu we encountered that the load factor "
+            "(%lf) is out of the interval [0, 1].",
+            clusterId,
+            loadFactor);
+
+    if (UNLIKELY(linkLoadFactor < 0.0 || linkLoadFactor > 1.0))
+        die("Registering the cluster %llu we encountered that the links' load "
+            "factor (%lf) is out of the interval [0, 1].",
+            clusterId,
+            linkLoadFactor);
+
+    m_Simulator->getServiceTable().registerCluster(clusterId,
+                                                   machines,
+                                                   power,
+                                                   loadFactor,
+                                                   cores,
+                                                   linkBandwidth,
+                                                   linkLoadFactor,
+                                                   linkLatency);
 }
 
 void ispd::model::Builder::registerDummy(const sid_t dummyId)
 {
-    m_Simulator->registerService(dummyId, [dummyId]() {
-        return ROOTSimAllocator<>::construct<Dummy>(dummyId);
-    });
+    m_Simulator->getServiceTable().registerDummy(dummyId);
+}
+
+/// \brief The maximum amount of tasks that are injected at once by the
+///        workload generators.
+///
+/// The tasks are injected in bounded batches, such that, the memory used to
+/// prepare them does not grow with the workload size.
+static constexpr uint32_t WorkloadBatchSize = 4096U;
+
+/// \brief Injects the specified amount of constant-sized tasks in the
+///        specified master.
+///
+/// \param nextArrivalTime A function that returns the arrival time of the
+///                        next task, which is called once per task in the
+///                        tasks' generation order.
+template <typename ArrivalTime>
+static void injectConstantSizedTasks(Master        *master,
+                                     const double   processingSize,
+                                     const double   communicationSize,
+                                     const uint32_t taskAmount,
+                                     ArrivalTime  &&nextArrivalTime)
+{
+    const sid_t    masterId  = master->getId();
+    const uint32_t batchSize = std::min(taskAmount, WorkloadBatchSize);
+
+    // The master is not quiescent until every injected task has arrived.
+    master->addPendingArrivals(taskAmount);
+
+    std::vector<Event>                events;
+    std::vector<ispd::ScheduledEvent> batch;
+
+    events.reserve(batchSize);
+    batch.reserve(batchSize);
+
+    for (uint32_t i = 0; i < taskAmount; i++) {
+        // It calculates a unique task identifier using the Szudzik's
+        // pairing function, taking the index of the task being generated
+        // and the master's identifier as arguments to generate the unique
+        // identifier.
+        const uint64_t taskId = szudzik(i, masterId);
+
+        // Prepare the event. The events' storage has been reserved up front,
+        // therefore, the event content is never moved while the batch is
+        // being prepared.
+        events.emplace_back(
+            Task(taskId, masterId, processingSize, communicationSize));
+        batch.push_back(ispd::ScheduledEvent{masterId,
+                                             nextArrivalTime(),
+                                             TASK_ARRIVAL,
+                                             &events.back(),
+                                             sizeof(Event)});
+
+        // It checks if the batch is full. If so, it is sent.
+        if (batch.size() == batchSize) {
+            ispd::schedule_events(batch.data(), batch.size());
+            events.clear();
+            batch.clear();
+        }
+    }
+
+    // Send the remaining events.
+    if (!batch.empty())
+        ispd::schedule_events(batch.data(), batch.size());
 }
 
 void ispd::model::workload::zeroth::addConstantSizedWorkload(
-    const sid_t    masterId,
+    Master        *master,
     const double   processingSize,
     const double   communicationSize,
     const uint32_t taskAmount,
@@ -124,42 +255,25 @@ void ispd::model::workload::zeroth::addConstantSizedWorkload(
     if (jittered) {
         timestamp_t arrivalTime = 0.0;
 
-        for (uint32_t i = 0; i < taskAmount; i++) {
-            // It calculates a unique task identifier using the Szudzik's
-            // pairing function, taking the index of the task being generated
-            // and the master's identifier as arguments to generate the unique
-            // identifier.
-            const uint64_t taskId = szudzik(i, masterId);
-
-            // Prepare the event.
-            Event e(Task(taskId, masterId, processingSize, communicationSize));
-
-            // Send the event.
-            ispd::schedule_event(
-                masterId, arrivalTime, TASK_ARRIVAL, &e, sizeof(e));
-
-            arrivalTime += 1e-52;
-        }
+        injectConstantSizedTasks(
+            master, processingSize, communicationSize, taskAmount, [&]() {
+                const timestamp_t time = arrivalTime;
+                arrivalTime            = std::nextafter(
+                    arrivalTime, std::numeric_limits<timestamp_t>::infinity());
+                return time;
+            });
     }
     else {
-        for (uint32_t i = 0; i < taskAmount; i++) {
-            // It calculates a unique task identifier using the Szudzik's
-            // pairing function, taking the index of the task being generated
-            // and the master's identifier as arguments to generate the unique
-            // identifier.
-            const uint64_t taskId = szudzik(i, masterId);
-
-            // Prepare the event.
-            Event e(Task(taskId, masterId, processingSize, communicationSize));
-
-            // Send the event.
-            ispd::schedule_event(masterId, 0.0, TASK_ARRIVAL, &e, sizeof(e));
-        }
+        injectConstantSizedTasks(master,
+                                 processingSize,
+                                 communicationSize,
+                                 taskAmount,
+                                 []() { return 0.0; });
     }
 }
 
 void ispd::model::workload::exp::addConstantSizedWorkload(
-    const sid_t    masterId,
+    Master        *master,
     const double   processingSize,
     const double   communicationSize,
     const uint32_t taskAmount)
@@ -175,20 +289,11 @@ void ispd::model::workload::exp::addConstantSizedWorkload(
     for (uint32_t i = 0; i < taskAmount; i++)
         queue.push(exp(engine));
 
-    uint32_t taskCount = 0;
-    while (!queue.empty()) {
-        // It calculates a unique task identifier using the Szudzik's
-        // pairing function, taking the index of the task being generated
-        // and the master's identifier as arguments to generate the unique
-        // identifier.
-        const uint64_t taskId = szudzik(taskCount++, masterId);
-
-        // Prepare the event.
-        Event e(Task(taskId, masterId, processingSize, communicationSize));
-
-        // Send the event.
-        ispd::schedule_event(
-            masterId, queue.top(), TASK_ARRIVAL, &e, sizeof(e));
-        queue.pop();
-    }
+    // The tasks are injected in non-decreasing arrival time order.
+    injectConstantSizedTasks(
+        master, processingSize, communicationSize, taskAmount, [&]() {
+            const timestamp_t time = queue.top();
+            queue.pop();
+            return time;
+        });
 }
@@ -0,0 +1,172 @@
+#include <functional>
+#include <limits>
+#include <queue>
+#include <routing/forwarding.hpp>
+#include <simulator/service_table.hpp>
+#include <tuple>
+#include <utility>
+
+ForwardingTable::ForwardingTable(const ispd::sim::ServiceTable &services,
+                                 const RouteMetric              metric)
+{
+    const sid_t serviceCount = services.size();
+
+    // The edges of the services' graph, as (service, neighbor, link, weight).
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t, double>> edges;
+    std::vector<bool> forwards(serviceCount, false);
+    std::vector<bool> isNode(serviceCount, false);
+    m_IsDestination.assign(serviceCount, false);
+
+    services.forEachLink([&](const sid_t  linkId,
+                             const sid_t  from,
+                             const sid_t  to,
+                             const double bandwidth,
+                             const double latency) {
+        double weight = 1.0;
+
+        if (metric == RouteMetric::LATENCY)
+            weight = latency;
+        else if (metric == RouteMetric::BANDWIDTH)
+            weight = 1.0 / bandwidth;
+
+        // It queries the kind of the link's endpoints, which also aborts the
+        // program if any of them has not been registered.
+        for (const sid_t endpoint : {from, to}) {
+            const ServiceKind kind = services.getKind(endpoint);
+            forwards[endpoint] = kind == ServiceKind::MACHINE ||
+                                 kind == ServiceKind::SHARING_MACHINE ||
+                                 kind == ServiceKind::SWITCH;
+            isNode[endpoint]   = true;
+
+            // The packets are only destined to the services that send or
+            // process the tasks, hence, never to a switch.
+            m_IsDestination[endpoint] = kind != ServiceKind::SWITCH;
+        }
+
+        const auto link = static_cast<uint32_t>(linkId);
+        const auto u    = static_cast<uint32_t>(from);
+        const auto v    = static_cast<uint32_t>(to);
+
+        edges.emplace_back(u, v, link, weight);
+        edges.emplace_back(v, u, link, weight);
+    });
+
+    // The edges are sorted by their services and, then, by their neighbors,
+    // such that, the ties are deterministically broken.
+    std::sort(edges.begin(), edges.end());
+
+    // The services that are the endpoint of some link, in increasing order,
+    // and the ones among them that may be a destination. Only the nodes have
+    // a forwarding table, and a shortest path tree is only computed for each
+    // destination.
+    std::vector<uint32_t> nodes;
+    std::vector<uint32_t> destinations;
+
+    for (sid_t id = 0; id < serviceCount; id++) {
+        if (isNode[id])
+            nodes.push_back(static_cast<uint32_t>(id));
+        if (m_IsDestination[id])
+            destinations.push_back(static_cast<uint32_t>(id));
+    }
+
+    std::vector<uint64_t> offsets(serviceCount + 1, 0ULL);
+
+    for (const auto &edge : edges)
+        offsets[std::get<0>(edge) + 1]++;
+
+    for (sid_t id = 0; id < serviceCount; id++)
+        offsets[id + 1] += offsets[id];
+
+    // The entries of each node, as (first destination, next service), in the
+    // order in which the destinations are visited. They are indexed by the
+    // node's position in `nodes`.
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> entries(
+        nodes.size());
+
+    std::vector<double>   distances(serviceCount,
+                                  std::numeric_limits<double>::infinity());
+    std::vector<uint32_t> hops(serviceCount, NoHop);
+    std::vector<uint32_t> touched;
+
+    using Entry = std::pair<double, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+
+    for (const uint32_t dest : destinations) {
+        // It computes the shortest path tree rooted at the destination. The
+        // next service of each service is the link through which the service
+        // has been reached from its parent in the tree.
+        distances[dest] = 0.0;
+        touched.push_back(dest);
+        queue.emplace(0.0, dest);
+
+        while (!queue.empty()) {
+            const auto [distance, u] = queue.top();
+            queue.pop();
+
+            if (distance > distances[u])
+                continue;
+
+            // Only the destination and the services that forward the packets
+            // may have their edges relaxed.
+            if (u != dest && !forwards[u])
+                continue;
+
+            for (uint64_t e = offsets[u]; e < offsets[u + 1]; e++) {
+                const auto &[service, neighbor, link, weight] = edges[e];
+                const double next = distance + weight;
+
+                if (next < distances[neighbor]) {
+                    if (distances[neighbor] ==
+                        std::numeric_limits<double>::infinity())
+                        touched.push_back(neighbor);
+
+                    distances[neighbor] = next;
+                    hops[neighbor]      = link;
+                    queue.emplace(next, neighbor);
+                }
+            }
+        }
+
+        // It appends an entry to each service whose next service differs from
+        // the one of its last entry. The first entry of each service starts
+        // at zero, such that, every node belongs to some range.
+        for (std::size_t n = 0; n < nodes.size(); n++) {
+            const uint32_t s = nodes[n];
+
+            if (s == dest)
+                continue;
+
+            auto &serviceEntries = entries[n];
+
+            if (serviceEntries.empty())
+                serviceEntries.emplace_back(0U, hops[s]);
+            else if (serviceEntries.back().second != hops[s])
+                serviceEntries.emplace_back(dest, hops[s]);
+        }
+
+        for (const uint32_t v : touched) {
+            distances[v] = std::numeric_limits<double>::infinity();
+            hops[v]      = NoHop;
+        }
+
+        touched.clear();
+    }
+
+    m_Offsets.assign(serviceCount + 1, 0ULL);
+
+    // The services that are not nodes have no entries.
+    std::size_t n = 0;
+
+    for (sid_t s = 0; s < serviceCount; s++) {
+        if (n < nodes.size() && nodes[n] == s) {
+            for (const auto &[start, hop] : entries[n]) {
+                m_RangeStarts.push_back(start);
+                m_NextHops.push_back(hop);
+            }
+
+            n++;
+        }
+
+        m_Offsets[s + 1] = m_RangeStarts.size();
+    }
+}
@@ -0,0 +1,360 @@
+#include <routing/implicit.hpp>
+#include <vector>
+
+/// \brief The buffer in which the routes are materialized by each thread.
+static thread_local std::vector<uint32_t> t_Path;
+
+Route ImplicitRouteProvider::getRoute(const uint32_t src,
+                                      const uint32_t dest) const
+{
+    const std::size_t length = getLength(src, dest);
+
+    t_Path.resize(length);
+
+    for (std::size_t offset = 0; offset < length; offset++)
+        t_Path[offset] = getHop(src, dest, offset);
+
+    return Route(length, t_Path.data());
+}
+
+StarRouteProvider::StarRouteProvider(const uint32_t nodeCount,
+                                     const bool     switched)
+    : m_NodeCount(nodeCount), m_Hub(switched ? 1U : 0U)
+{
+    if (UNLIKELY(nodeCount <= m_Hub || nodeCount > UINT32_MAX / 2U))
+        die("A star with %u nodes is not supported.", nodeCount);
+}
+
+uint32_t StarRouteProvider::toNode(const uint32_t serviceId) const
+{
+    // It checks if the service is not a node, that is, if it is a link or
+    // it is out of the topology. If so, the program is immediately aborted.
+    if (UNLIKELY(serviceId % 2U || serviceId / 2U >= m_NodeCount))
+        die("Service with id %u is not a node of the star.", serviceId);
+
+    return serviceId / 2U;
+}
+
+std::size_t StarRouteProvider::getLength(const uint32_t src,
+                                         const uint32_t dest) const
+{
+    const uint32_t a = toNode(src);
+    const uint32_t b = toNode(dest);
+
+    if (UNLIKELY(a == b))
+        die("No route from %u to %u has been defined.", src, dest);
+
+    // The route between two leaves passes through the hub.
+    return (a == m_Hub || b == m_Hub) ? 1ULL : 2ULL;
+}
+
+uint32_t StarRouteProvider::getHop(const uint32_t    src,
+                                   const uint32_t    dest,
+                                   const std::size_t offset) const
+{
+    const uint32_t a = toNode(src);
+
+    // The first element is the source's link, unless the source is the
+    // hub itself. Otherwise, it is the destination's link.
+    if (offset == 0ULL && a != m_Hub)
+        return getLinkId(a);
+
+    return getLinkId(toNode(dest));
+}
+
+KaryTreeRouteProvider::KaryTreeRouteProvider(const uint32_t nodeCount,
+                                             const uint32_t arity)
+    : m_NodeCount(nodeCount), m_Arity(arity)
+{
+    if (UNLIKELY(arity == 0U || nodeCount == 0U ||
+                 nodeCount > UINT32_MAX / 2U))
+        die("A %u-ary tree with %u nodes is not supported.", arity, nodeCount);
+}
+
+uint32_t KaryTreeRouteProvider::toNode(const uint32_t serviceId) const
+{
+    // It checks if the service is not a node, that is, if it is a link or
+    // it is out of the topology. If so, the program is immediately aborted.
+    if (UNLIKELY(serviceId % 2U || serviceId / 2U >= m_NodeCount))
+        die("Service with id %u is not a node of the tree.", serviceId);
+
+    return serviceId / 2U;
+}
+
+uint32_t KaryTreeRouteProvider::getDepth(uint32_t node) const
+{
+    uint32_t depth = 0U;
+
+    for (; node > 0U; depth++)
+        node = (node - 1U) / m_Arity;
+
+    return depth;
+}
+
+uint32_t KaryTreeRouteProvider::getAncestor(uint32_t       node,
+                                            const uint32_t levels) const
+{
+    for (uint32_t i = 0U; i < levels; i++)
+        node = (node - 1U) / m_Arity;
+
+    return node;
+}
+
+std::size_t KaryTreeRouteProvider::getLength(const uint32_t src,
+                                             const uint32_t dest) const
+{
+    uint32_t a = toNode(src);
+    uint32_t b = toNode(dest);
+
+    if (UNLIKELY(a == b))
+        die("No route from %u to %u has been defined.", src, dest);
+
+    const uint32_t depthA = getDepth(a);
+    const uint32_t depthB = getDepth(b);
+
+    // It climbs from the deepest node to the depth of the other one and,
+    // then, from both nodes until the lowest common ancestor is found.
+    std::size_t length = 0ULL;
+
+    if (depthA > depthB)
+        a = getAncestor(a, depthA - depthB);
+    else
+        b = getAncestor(b, depthB - depthA);
+
+    for (; a != b; length += 2ULL) {
+        a = (a - 1U) / m_Arity;
+        b = (b - 1U) / m_Arity;
+    }
+
+    return length + (depthA > depthB ? depthA - depthB : depthB - depthA);
+}
+
+uint32_t KaryTreeRouteProvider::getHop(const uint32_t    src,
+                                       const uint32_t    dest,
+                                       const std::size_t offset) const
+{
+    const uint32_t a      = toNode(src);
+    const uint32_t b      = toNode(dest);
+    const uint32_t depthA = getDepth(a);
+    const uint32_t depthB = getDepth(b);
+    const auto     length = static_cast<uint32_t>(getLength(src, dest));
+
+    // The amount of links from the source up to the lowest common ancestor,
+    // which is obtained from the route's length and the nodes' depths.
+    const uint32_t up = (length + depthA - depthB) / 2U;
+
+    // Upwards, the link is the one between the source's ancestor and its
+    // parent. Downwards, the link is the one between the destination's
+    // ancestor and its parent, counted from the lowest common ancestor.
+    if (offset < up)
+        return 2U * getAncestor(a, static_cast<uint32_t>(offset)) - 1U;
+
+    return 2U * getAncestor(b, length - 1U - static_cast<uint32_t>(offset)) -
+           1U;
+}
+
+TorusRouteProvider::TorusRouteProvider(const uint32_t  dimensions,
+                                       const uint32_t *extents,
+                                       const bool      wraparound)
+    : m_Dimensions(dimensions), m_Extents{1U, 1U, 1U}, m_NodeCount(1ULL),
+      m_Wraparound(wraparound)
+{
+    if (UNLIKELY(dimensions < 1U || dimensions > 3U))
+        die("A torus with %u dimensions is not supported.", dimensions);
+
+    for (uint32_t d = 0U; d < dimensions; d++) {
+        if (UNLIKELY(extents[d] == 0U))
+            die("A torus with an empty dimension is not supported.");
+
+        m_Extents[d]  = extents[d];
+        m_NodeCount  *= extents[d];
+    }
+
+    // It checks if the services' identifiers do not fit in 32 bits. If so,
+    // the program is immediately aborted.
+    if (UNLIKELY(m_NodeCount * (dimensions + 1ULL) > UINT32_MAX))
+        die("A torus with %llu nodes is not supported.", m_NodeCount);
+}
+
+void TorusRouteProvider::toCoordinates(const uint32_t serviceId,
+                                       uint32_t      *coordinates) const
+{
+    const uint32_t stride = m_Dimensions + 1U;
+
+    // It checks if the service is not a node, that is, if it is a link or
+    // it is out of the topology. If so, the program is immediately aborted.
+    if (UNLIKELY(serviceId % stride || serviceId / stride >= m_NodeCount))
+        die("Service with id %u is not a node of the torus.", serviceId);
+
+    uint32_t node = serviceId / stride;
+
+    for (uint32_t d = 0U; d < 3U; d++) {
+        coordinates[d]  = node % m_Extents[d];
+        node           /= m_Extents[d];
+    }
+}
+
+uint32_t TorusRouteProvider::getSteps(const uint32_t dimension,
+                                      const uint32_t from,
+                                      const uint32_t to,
+                                      bool          &successor) const
+{
+    if (!m_Wraparound) {
+        successor = to >= from;
+        return successor ? to - from : from - to;
+    }
+
+    const uint32_t extent   = m_Extents[dimension];
+    const uint32_t forward  = (to + extent - from) % extent;
+    const uint32_t backward = (extent - forward) % extent;
+
+    successor = forward <= backward;
+    return successor ? forward : backward;
+}
+
+std::size_t TorusRouteProvider::getLength(const uint32_t src,
+                                          const uint32_t dest) const
+{
+    uint32_t a[3];
+    uint32_t b[3];
+    bool     successor;
+
+    toCoordinates(src, a);
+    toCoordinates(dest, b);
+
+    std::size_t length = 0ULL;
+
+    for (uint32_t d = 0U; d < m_Dimensions; d++)
+        length += getSteps(d, a[d], b[d], successor);
+
+    if (UNLIKELY(length == 0ULL))
+        die("No route from %u to %u has been defined.", src, dest);
+
+    return length;
+}
+
+uint32_t TorusRouteProvider::getHop(const uint32_t src,
+                                    const uint32_t dest,
+                                    std::size_t    offset) const
+{
+    // It checks if the offset is out of the route. If so, the program is
+    // immediately aborted.
+    if (UNLIKELY(offset >= getLength(src, dest)))
+        die("No route from %u to %u has an element at offset %zu.",
+            src,
+            dest,
+            offset);
+
+    uint32_t position[3];
+    uint32_t b[3];
+    bool     successor;
+
+    toCoordinates(src, position);
+    toCoordinates(dest, b);
+
+    // The dimensions are traversed in order, therefore, the dimensions that
+    // precede the hop's dimension are already at the destination's
+    // coordinates, and the ones that follow it are still at the source's.
+    uint32_t d     = 0U;
+    uint32_t steps = getSteps(d, position[d], b[d], successor);
+
+    while (offset >= steps) {
+        offset      -= steps;
+        position[d]  = b[d];
+        d++;
+        steps = getSteps(d, position[d], b[d], successor);
+    }
+
+    const uint32_t extent = m_Extents[d];
+    const auto     moved  = static_cast<uint32_t>(offset);
+
+    // The link towards the successor is owned by the current node, while the
+    // link towards the predecessor is owned by the predecessor.
+    if (successor)
+        position[d] = (position[d] + moved) % extent;
+    else
+        position[d] = (position[d] + extent - moved - 1U) % extent;
+
+    const uint32_t node =
+        position[0] + m_Extents[0] * (position[1] + m_Extents[1] * position[2]);
+
+    return (m_Dimensions + 1U) * node + 1U + d;
+}
+
+FatTreeRouteProvider::FatTreeRouteProvider(const uint32_t arity)
+    : m_Half(arity / 2U), m_HostCount(arity * (arity / 2U) * (arity / 2U)),
+      m_PodSwitchCount(arity * (arity / 2U))
+{
+    if (UNLIKELY(arity < 2U || arity % 2U || arity > 1024U))
+        die("A %u-ary fat-tree is not supported.", arity);
+
+    m_SwitchEnd = m_HostCount + 2U * m_PodSwitchCount + m_Half * m_Half;
+}
+
+void FatTreeRouteProvider::checkHost(const uint32_t serviceId) const
+{
+    if (UNLIKELY(serviceId >= m_HostCount))
+        die("Service with id %u is not a host of the fat-tree.", serviceId);
+}
+
+std::size_t FatTreeRouteProvider::getLength(const uint32_t src,
+                                            const uint32_t dest) const
+{
+    checkHost(src);
+    checkHost(dest);
+
+    if (UNLIKELY(src == dest))
+        die("No route from %u to %u has been defined.", src, dest);
+
+    // The hosts are connected to the same edge switch, to the same pod or
+    // only through the core switches, respectively.
+    if (src / m_Half == dest / m_Half)
+        return 2ULL;
+
+    if (src / (m_Half * m_Half) == dest / (m_Half * m_Half))
+        return 4ULL;
+
+    return 6ULL;
+}
+
+uint32_t FatTreeRouteProvider::getHop(const uint32_t    src,
+                                      const uint32_t    dest,
+                                      const std::size_t offset) const
+{
+    const std::size_t length = getLength(src, dest);
+
+    // It checks if the offset is out of the route. If so, the program is
+    // immediately aborted.
+    if (UNLIKELY(offset >= length))
+        die("No route from %u to %u has an element at offset %zu.",
+            src,
+            dest,
+            offset);
+
+    const uint32_t podA  = src / (m_Half * m_Half);
+    const uint32_t podB  = dest / (m_Half * m_Half);
+    const uint32_t edgeA = (src / m_Half) % m_Half;
+    const uint32_t edgeB = (dest / m_Half) % m_Half;
+
+    // The aggregation switch and the core switch's port are selected by
+    // the destination host.
+    const uint32_t aggr = dest % m_Half;
+    const uint32_t port = (dest / m_Half) % m_Half;
+
+    // The route is symmetric, that is, the second half of the route is the
+    // first half of the route from the destination, in the reverse order.
+    const bool        upwards = offset < length / 2U;
+    const uint32_t    host    = upwards ? src : dest;
+    const uint32_t    pod     = upwards ? podA : podB;
+    const uint32_t    edge    = upwards ? edgeA : edgeB;
+    const std::size_t level   = upwards ? offset : length - 1U - offset;
+
+    switch (level) {
+    case 0:
+        return getHostLinkId(host);
+    case 1:
+        return getEdgeLinkId(pod, edge, aggr);
+    default:
+        return getCoreLinkId(pod, aggr, port);
+    }
+}
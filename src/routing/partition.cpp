@@ -0,0 +1,96 @@
+#include <cstdlib>
+#include <memory>
+#include <routing/partition.hpp>
+#include <simulator/service_table.hpp>
+#include <vector>
+
+PartitionMap::PartitionMap(const uint32_t rank,
+                           const uint32_t rankCount,
+                           const uint64_t serviceCount)
+    : m_Rank(rank), m_RankCount(rankCount), m_ServiceCount(serviceCount)
+{
+    if (UNLIKELY(rankCount == 0U || rank >= rankCount))
+        die("Rank %u of %u ranks is not supported.", rank, rankCount);
+
+    // An empty partition map is treated as if it had a single service, such
+    // that, no division by zero happens.
+    if (m_ServiceCount == 0ULL)
+        m_ServiceCount = 1ULL;
+}
+
+/// \brief Reads the specified environment variable as an unsigned integer,
+///        returning true if the variable is set and is a valid integer.
+static bool readVariable(const char *name, uint32_t &value)
+{
+    const char *text = std::getenv(name);
+
+    if (!text || !*text)
+        return false;
+
+    char               *end;
+    const unsigned long parsed = std::strtoul(text, &end, 10);
+
+    if (*end != '\0' || parsed > UINT32_MAX)
+        return false;
+
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+PartitionMap PartitionMap::fromEnvironment(const uint64_t serviceCount)
+{
+    // The variables set by Open MPI, by MPICH (and its derivatives) and by
+    // Slurm, respectively, as (rank, amount of ranks).
+    static constexpr const char *Variables[][2] = {
+        {"OMPI_COMM_WORLD_RANK", "OMPI_COMM_WORLD_SIZE"},
+        {"PMI_RANK", "PMI_SIZE"},
+        {"SLURM_PROCID", "SLURM_NTASKS"},
+    };
+
+    for (const auto &[rankName, sizeName] : Variables) {
+        uint32_t rank;
+        uint32_t rankCount;
+
+        if (readVariable(rankName, rank) && readVariable(sizeName, rankCount))
+            return PartitionMap(rank, rankCount, serviceCount);
+    }
+
+    return PartitionMap(0U, 1U, serviceCount);
+}
+
+RouteFilter
+PartitionMap::makeRouteFilter(const ispd::sim::ServiceTable &services) const
+{
+    // It marks the elements that are hosted by this rank and the links that
+    // have an endpoint hosted by this rank, such that, the filter only has to
+    // test each route's element once.
+    auto touches = std::make_shared<std::vector<bool>>(services.size(), false);
+
+    for (sid_t id = 0; id < services.size(); id++)
+        (*touches)[id] = isLocal(id);
+
+    services.forEachLink([&](const sid_t linkId,
+                             const sid_t from,
+                             const sid_t to,
+                             double,
+                             double) {
+        if (isLocal(from) || isLocal(to))
+            (*touches)[linkId] = true;
+    });
+
+    const PartitionMap partition = *this;
+
+    return [partition, touches](const uint32_t    src,
+                                const uint32_t    dest,
+                                const uint32_t   *elements,
+                                const std::size_t count) {
+        if (partition.isLocal(src) || partition.isLocal(dest))
+            return true;
+
+        for (std::size_t i = 0; i < count; i++)
+            if (elements[i] < touches->size() && (*touches)[elements[i]])
+                return true;
+
+        return false;
+    };
+}
@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <routing/shortest_path.hpp>
+#include <utility>
+
+/// \brief The generator of the providers' unique identifiers.
+static std::atomic<uint64_t> s_NextGeneration{1ULL};
+
+/// \brief The route cache of a thread.
+///
+/// The cache is direct-mapped, that is, each pair of services has a single
+/// slot, which is overwritten by the last route computed to any pair mapped
+/// to the same slot. The slots' vectors keep their storage, such that, a
+/// thread stops allocating as soon as its slots have been warmed.
+struct RouteCache
+{
+    struct Slot
+    {
+        /// \brief The cached pair of services, or zero if the slot is empty.
+        uint64_t              m_Key = 0ULL;
+        std::vector<uint32_t> m_Path;
+    };
+
+    uint64_t          m_Generation = 0ULL;
+    std::vector<Slot> m_Slots;
+
+    /// \brief The Dijkstra's algorithm scratch arrays, which are indexed by
+    ///        the services' identifiers and are reset after each run.
+    std::vector<double>   m_Distances;
+    std::vector<uint64_t> m_PreviousEdges;
+    std::vector<uint32_t> m_Touched;
+};
+
+static thread_local RouteCache t_Cache;
+
+/// \brief The indicator of a service that has not been reached.
+static constexpr uint64_t NoEdge = UINT64_MAX;
+
+ShortestPathRouteProvider::ShortestPathRouteProvider(
+    const ispd::sim::ServiceTable &services,
+    const RouteMetric              metric,
+    const std::size_t              cacheCapacity)
+    : m_CacheCapacity(1U), m_Generation(s_NextGeneration++)
+{
+    const sid_t serviceCount = services.size();
+
+    while (m_CacheCapacity < cacheCapacity)
+        m_CacheCapacity <<= 1U;
+
+    std::vector<std::pair<uint32_t, Edge>> edges;
+    m_Forwards.resize(serviceCount, false);
+
+    services.forEachLink([&](const sid_t  linkId,
+                             const sid_t  from,
+                             const sid_t  to,
+                             const double bandwidth,
+                             const double latency) {
+        double weight = 1.0;
+
+        if (metric == RouteMetric::LATENCY)
+            weight = latency;
+        else if (metric == RouteMetric::BANDWIDTH)
+            weight = 1.0 / bandwidth;
+
+        // It queries the kind of the link's endpoints, which also aborts the
+        // program if any of them has not been registered.
+        for (const sid_t endpoint : {from, to}) {
+            const ServiceKind kind = services.getKind(endpoint);
+            m_Forwards[endpoint] = kind == ServiceKind::MACHINE ||
+                                   kind == ServiceKind::SHARING_MACHINE ||
+                                   kind == ServiceKind::SWITCH;
+        }
+
+        const auto link = static_cast<uint32_t>(linkId);
+        const auto u    = static_cast<uint32_t>(from);
+        const auto v    = static_cast<uint32_t>(to);
+
+        edges.emplace_back(u, Edge{v, link, weight});
+        edges.emplace_back(v, Edge{u, link, weight});
+    });
+
+    // The edges are sorted by their services and, then, by their neighbors,
+    // such that, the ties are deterministically broken.
+    std::sort(edges.begin(), edges.end(), [](const auto &a, const auto &b) {
+        if (a.first != b.first)
+            return a.first < b.first;
+        if (a.second.m_Neighbor != b.second.m_Neighbor)
+            return a.second.m_Neighbor < b.second.m_Neighbor;
+        return a.second.m_Link < b.second.m_Link;
+    });
+
+    m_Offsets.assign(serviceCount + 1, 0ULL);
+    m_Edges.reserve(edges.size());
+
+    for (const auto &[service, edge] : edges) {
+        m_Offsets[service + 1]++;
+        m_Edges.push_back(edge);
+    }
+
+    for (sid_t id = 0; id < serviceCount; id++)
+        m_Offsets[id + 1] += m_Offsets[id];
+}
+
+Route ShortestPathRouteProvider::getRoute(const uint32_t src,
+                                          const uint32_t dest) const
+{
+    RouteCache &cache = t_Cache;
+
+    // It checks if the thread's cache has been filled by another provider.
+    // If so, the cache is cleared.
+    if (UNLIKELY(cache.m_Generation != m_Generation)) {
+        cache.m_Generation = m_Generation;
+        cache.m_Slots.clear();
+        cache.m_Slots.resize(m_CacheCapacity);
+    }
+
+    // The key is offset by one, such that, the zero key indicates an empty
+    // slot. The slot is selected by a multiplicative hash of the key.
+    const uint64_t key  = ((uint64_t(src) << 32U) | dest) + 1ULL;
+    const uint64_t hash = key * 0x9E3779B97F4A7C15ULL;
+    auto          &slot = cache.m_Slots[(hash >> 32U) & (m_CacheCapacity - 1)];
+
+    if (slot.m_Key != key) {
+        computeRoute(src, dest, slot.m_Path);
+        slot.m_Key = key;
+    }
+
+    return Route(slot.m_Path.size(), slot.m_Path.data());
+}
+
+void ShortestPathRouteProvider::computeRoute(const uint32_t         src,
+                                             const uint32_t         dest,
+                                             std::vector<uint32_t> &path) const
+{
+    const std::size_t serviceCount = m_Forwards.size();
+
+    if (UNLIKELY(src >= serviceCount || dest >= serviceCount || src == dest))
+        die("No route from %u to %u has been found.", src, dest);
+
+    RouteCache &cache = t_Cache;
+
+    if (cache.m_Distances.size() != serviceCount) {
+        cache.m_Distances.assign(serviceCount,
+                                 std::numeric_limits<double>::infinity());
+        cache.m_PreviousEdges.assign(serviceCount, NoEdge);
+    }
+
+    using Entry = std::pair<double, uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+
+    cache.m_Distances[src] = 0.0;
+    cache.m_Touched.push_back(src);
+    queue.emplace(0.0, src);
+
+    while (!queue.empty()) {
+        const auto [distance, u] = queue.top();
+        queue.pop();
+
+        // It checks if the entry is stale, that is, if the service has been
+        // reached through a shorter path after the entry has been pushed.
+        if (distance > cache.m_Distances[u])
+            continue;
+
+        if (u == dest)
+            break;
+
+        // Only the source and the services that forward the packets may have
+        // their edges relaxed.
+        if (u != src && !m_Forwards[u])
+            continue;
+
+        for (uint64_t e = m_Offsets[u]; e < m_Offsets[u + 1]; e++) {
+            const Edge  &edge = m_Edges[e];
+            const double next = distance + edge.m_Weight;
+
+            if (next < cache.m_Distances[edge.m_Neighbor]) {
+                if (cache.m_PreviousEdges[edge.m_Neighbor] == NoEdge)
+                    cache.m_Touched.push_back(edge.m_Neighbor);
+
+                cache.m_Distances[edge.m_Neighbor]     = next;
+                cache.m_PreviousEdges[edge.m_Neighbor] = e;
+                queue.emplace(next, edge.m_Neighbor);
+            }
+        }
+    }
+
+    const bool reached = cache.m_PreviousEdges[dest] != NoEdge;
+    path.clear();
+
+    // It walks back from the destination to the source, collecting the links
+    // of the route in the reverse order.
+    if (reached) {
+        for (uint32_t v = dest; v != src;) {
+            const uint64_t e = cache.m_PreviousEdges[v];
+            path.push_back(m_Edges[e].m_Link);
+
+            // The edge's owner is the service whose edges range contains it.
+            const auto owner = std::upper_bound(m_Offsets.begin(),
+                                                m_Offsets.end(),
+                                                e) -
+                               m_Offsets.begin() - 1;
+            v = static_cast<uint32_t>(owner);
+        }
+
+        std::reverse(path.begin(), path.end());
+    }
+
+    for (const uint32_t v : cache.m_Touched) {
+        cache.m_Distances[v]     = std::numeric_limits<double>::infinity();
+        cache.m_PreviousEdges[v] = NoEdge;
+    }
+
+    cache.m_Touched.clear();
+
+    if (UNLIKELY(!reached))
+        die("No route from %u to %u has been found.", src, dest);
+}
@@ -0,0 +1,648 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <routing/table.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+
+/// \brief Returns the specified size rounded up to a multiple of 8 bytes.
+ENGINE_INLINE static uint64_t align8(const uint64_t size)
+{
+    return (size + 7ULL) & ~7ULL;
+}
+
+std::size_t RoutingTable::imageSize(const uint64_t sourceCount,
+                                    const uint64_t routeCount,
+                                    const uint64_t alternativeCount,
+                                    const uint64_t pathCount,
+                                    uint64_t      *offsets)
+{
+    uint64_t sizes[7] = {sourceCount * sizeof(uint32_t),
+                         (sourceCount + 1ULL) * sizeof(uint64_t),
+                         routeCount * sizeof(uint32_t),
+                         (routeCount + 1ULL) * sizeof(uint64_t),
+                         alternativeCount * sizeof(uint64_t),
+                         alternativeCount * sizeof(uint32_t),
+                         pathCount * sizeof(uint32_t)};
+    uint64_t size     = align8(sizeof(RoutingFileHeader));
+
+    for (int i = 0; i < 7; i++) {
+        if (offsets)
+            offsets[i] = size;
+        size += align8(sizes[i]);
+    }
+
+    return size;
+}
+
+void RoutingTable::attach(const unsigned char *image)
+{
+    const auto *header = reinterpret_cast<const RoutingFileHeader *>(image);
+    uint64_t    offsets[7];
+
+    imageSize(header->m_SourceCount,
+              header->m_RouteCount,
+              header->m_AlternativeCount,
+              header->m_PathCount,
+              offsets);
+
+    m_Image            = image;
+    m_SourceCount      = header->m_SourceCount;
+    m_RouteCount       = header->m_RouteCount;
+    m_AlternativeCount = header->m_AlternativeCount;
+    m_PathCount        = header->m_PathCount;
+    m_Sources       = reinterpret_cast<const uint32_t *>(image + offsets[0]);
+    m_SourceOffsets = reinterpret_cast<const uint64_t *>(image + offsets[1]);
+    m_Destinations  = reinterpret_cast<const uint32_t *>(image + offsets[2]);
+    m_AlternativeOffsets =
+        reinterpret_cast<const uint64_t *>(image + offsets[3]);
+    m_PathStarts  = reinterpret_cast<const uint64_t *>(image + offsets[4]);
+    m_PathLengths = reinterpret_cast<const uint32_t *>(image + offsets[5]);
+    m_Paths       = reinterpret_cast<const uint32_t *>(image + offsets[6]);
+}
+
+RoutingTable::~RoutingTable()
+{
+    if (m_Mapping)
+        munmap(m_Mapping, m_MappingSize);
+}
+
+RoutingTable *RoutingTable::map(const std::string &filepath)
+{
+    const int fd = open(filepath.c_str(), O_RDONLY);
+
+    // It checks if the file could not be opened for some reason. If so,
+    // then the program is immediately aborted.
+    if (fd < 0)
+        die("Routing file '%s' could not be opened", filepath.c_str());
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+        die("Routing file '%s' could not be inspected", filepath.c_str());
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+
+    if (size < sizeof(RoutingFileHeader))
+        die("Routing file '%s' is truncated", filepath.c_str());
+
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+    // The mapping remains valid after the file descriptor is closed.
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+        die("Routing file '%s' could not be mapped", filepath.c_str());
+
+    const auto *header = static_cast<const RoutingFileHeader *>(mapping);
+
+    // It checks if the file is a valid binary routing file. If not, then the
+    // program is immediately aborted.
+    if (std::memcmp(
+            header->m_Magic, RoutingFileMagic, sizeof(RoutingFileMagic)) != 0)
+        die("Routing file '%s' is not a binary routing file", filepath.c_str());
+
+    if (header->m_Version != RoutingFileVersion)
+        die("Routing file '%s' has version %u, but version %u is expected",
+            filepath.c_str(),
+            header->m_Version,
+            RoutingFileVersion);
+
+    if (header->m_ByteOrderMark != RoutingFileByteOrderMark)
+        die("Routing file '%s' has been written with another byte order",
+            filepath.c_str());
+
+    if (header->m_FileSize != size ||
+        imageSize(header->m_SourceCount,
+                  header->m_RouteCount,
+                  header->m_AlternativeCount,
+                  header->m_PathCount) != size)
+        die("Routing file '%s' is truncated or corrupted", filepath.c_str());
+
+    RoutingTable *rt  = new RoutingTable();
+    rt->m_Mapping     = mapping;
+    rt->m_MappingSize = size;
+    rt->attach(static_cast<const unsigned char *>(mapping));
+
+    // It checks if the offsets are monotonic and inside the arrays, such
+    // that, a corrupted file does not lead to out-of-bounds accesses of the
+    // table's arrays. The amount of services is not known by the table,
+    // therefore, the services' identifiers in the paths are not checked
+    // here, but by the native engines when an event is scheduled to them.
+    if (rt->m_SourceOffsets[0] != 0ULL ||
+        rt->m_SourceOffsets[rt->m_SourceCount] != rt->m_RouteCount ||
+        rt->m_AlternativeOffsets[0] != 0ULL ||
+        rt->m_AlternativeOffsets[rt->m_RouteCount] != rt->m_AlternativeCount)
+        die("Routing file '%s' is corrupted", filepath.c_str());
+
+    for (uint64_t i = 0; i < rt->m_SourceCount; i++)
+        if (rt->m_SourceOffsets[i] > rt->m_SourceOffsets[i + 1])
+            die("Routing file '%s' is corrupted", filepath.c_str());
+
+    // Every route must have at least one alternative.
+    for (uint64_t r = 0; r < rt->m_RouteCount; r++)
+        if (rt->m_AlternativeOffsets[r] >= rt->m_AlternativeOffsets[r + 1])
+            die("Routing file '%s' is corrupted", filepath.c_str());
+
+    for (uint64_t a = 0; a < rt->m_AlternativeCount; a++)
+        if (rt->m_PathStarts[a] > rt->m_PathCount ||
+            rt->m_PathLengths[a] > rt->m_PathCount - rt->m_PathStarts[a])
+            die("Routing file '%s' is corrupted", filepath.c_str());
+
+    return rt;
+}
+
+void RoutingTable::write(const std::string &filepath) const
+{
+    const auto   *header = reinterpret_cast<const RoutingFileHeader *>(m_Image);
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+        die("Routing file '%s' could not be created", filepath.c_str());
+
+    file.write(reinterpret_cast<const char *>(m_Image), header->m_FileSize);
+
+    if (!file)
+        die("Routing file '%s' could not be written", filepath.c_str());
+}
+
+RoutingTable *RoutingTable::filter(const RouteFilter &filter) const
+{
+    RoutingTableBuilder   builder;
+    std::vector<uint32_t> elements;
+
+    for (uint64_t i = 0; i < m_SourceCount; i++) {
+        for (uint64_t r = m_SourceOffsets[i]; r < m_SourceOffsets[i + 1]; r++) {
+            const uint64_t first = m_AlternativeOffsets[r];
+            const uint64_t last  = m_AlternativeOffsets[r + 1];
+
+            // The filter is called with the elements of all alternatives.
+            elements.clear();
+
+            for (uint64_t a = first; a < last; a++)
+                elements.insert(elements.end(),
+                                m_Paths + m_PathStarts[a],
+                                m_Paths + m_PathStarts[a] + m_PathLengths[a]);
+
+            const uint32_t src  = m_Sources[i];
+            const uint32_t dest = m_Destinations[r];
+
+            if (!filter(src, dest, elements.data(), elements.size()))
+                continue;
+
+            for (uint64_t a = first; a < last; a++) {
+                const uint32_t *path = m_Paths + m_PathStarts[a];
+
+                if (a == first)
+                    builder.addRoute(src, dest, m_PathLengths[a], path);
+                else
+                    builder.addEqualCostPath(src, dest, m_PathLengths[a], path);
+            }
+        }
+    }
+
+    return builder.build();
+}
+
+RoutingTable *RoutingTableBuilder::build()
+{
+    // Sort the routes by their source and destination services. The sort is
+    // stable, therefore, the routes added later are placed after the routes
+    // added earlier with the same source and destination services.
+    std::stable_sort(m_Entries.begin(),
+                     m_Entries.end(),
+                     [](const Entry &a, const Entry &b) {
+                         return a.m_Source < b.m_Source ||
+                                (a.m_Source == b.m_Source &&
+                                 a.m_Destination < b.m_Destination);
+                     });
+
+    // Remove the replaced routes, keeping the alternatives of the last added
+    // route of each pair of source and destination services. The entries
+    // that are kept are the alternatives, and the alternatives of the r-th
+    // route are in the range [routeFirsts[r], routeFirsts[r + 1]).
+    std::vector<Entry>    entries;
+    std::vector<uint64_t> routeFirsts;
+    entries.reserve(m_Entries.size());
+
+    for (const Entry &entry : m_Entries) {
+        if (!entries.empty() &&
+            entries.back().m_Source == entry.m_Source &&
+            entries.back().m_Destination == entry.m_Destination) {
+            if (!entry.m_IsAlternative)
+                entries.resize(routeFirsts.back());
+        }
+        else
+            routeFirsts.push_back(entries.size());
+
+        entries.push_back(entry);
+    }
+
+    const std::size_t routeCount = routeFirsts.size();
+    routeFirsts.push_back(entries.size());
+
+    // The alternatives of each source are inserted in a trie, in which each
+    // node is a path from the source and each edge is a path element. Each
+    // alternative is, then, a node of its source's trie.
+    std::vector<uint32_t> routeNodes(entries.size());
+    std::vector<uint64_t> pathStarts(entries.size());
+    std::vector<uint32_t> pathLengths(entries.size());
+    std::vector<uint32_t> paths;
+    uint64_t              sourceCount = 0;
+
+    // The trie's nodes, in which the node 0 is the root, and the children of
+    // each node, indexed by the parent node and the path element.
+    std::vector<TrieNode>                  nodes;
+    std::unordered_map<uint64_t, uint32_t> children;
+    std::vector<bool>                      stored;
+
+    for (std::size_t first = 0, last; first < entries.size(); first = last) {
+        const uint32_t source = entries[first].m_Source;
+
+        for (last = first; last < entries.size(); last++)
+            if (entries[last].m_Source != source)
+                break;
+
+        sourceCount++;
+        nodes.assign(1, TrieNode{0U, 0U, 0U, false, 0ULL});
+        children.clear();
+
+        for (std::size_t i = first; i < last; i++) {
+            const Entry &entry = entries[i];
+            uint32_t     node  = 0U;
+
+            for (std::size_t j = 0; j < entry.m_PathLength; j++) {
+                const uint32_t element = m_Paths[entry.m_PathStart + j];
+                const uint64_t key     = (uint64_t(node) << 32U) | element;
+                const auto [it, inserted] =
+                    children.try_emplace(key, uint32_t(nodes.size()));
+
+                if (inserted) {
+                    nodes[node].m_IsLeaf = false;
+                    nodes.push_back(TrieNode{
+                        node, element, nodes[node].m_Depth + 1U, true, 0ULL});
+                }
+
+                node = it->second;
+            }
+
+            routeNodes[i] = node;
+        }
+
+        // The path of each leaf is copied to the path pool, and every node in
+        // that path that has not been stored yet is stored as its prefix.
+        stored.assign(nodes.size(), false);
+        stored[0] = true;
+
+        for (uint32_t leaf = 1; leaf < nodes.size(); leaf++) {
+            if (!nodes[leaf].m_IsLeaf)
+                continue;
+
+            const uint64_t start = paths.size();
+            paths.resize(start + nodes[leaf].m_Depth);
+
+            for (uint32_t node = leaf; node != 0U;) {
+                const TrieNode &current = nodes[node];
+                paths[start + current.m_Depth - 1U] = current.m_Element;
+
+                if (!stored[node]) {
+                    nodes[node].m_Start = start;
+                    stored[node]        = true;
+                }
+
+                node = current.m_Parent;
+            }
+        }
+
+        for (std::size_t i = first; i < last; i++) {
+            pathStarts[i]  = nodes[routeNodes[i]].m_Start;
+            pathLengths[i] = nodes[routeNodes[i]].m_Depth;
+        }
+    }
+
+    uint64_t          offsets[7];
+    const std::size_t size = RoutingTable::imageSize(
+        sourceCount, routeCount, entries.size(), paths.size(), offsets);
+
+    RoutingTable *rt = new RoutingTable();
+    rt->m_Storage.resize(size / sizeof(uint64_t));
+
+    auto *image  = reinterpret_cast<unsigned char *>(rt->m_Storage.data());
+    auto *header = reinterpret_cast<RoutingFileHeader *>(image);
+
+    std::memcpy(header->m_Magic, RoutingFileMagic, sizeof(RoutingFileMagic));
+    header->m_Version       = RoutingFileVersion;
+    header->m_ByteOrderMark = RoutingFileByteOrderMark;
+    header->m_SourceCount      = sourceCount;
+    header->m_RouteCount       = routeCount;
+    header->m_AlternativeCount = entries.size();
+    header->m_PathCount        = paths.size();
+    header->m_FileSize         = size;
+
+    auto *sources       = reinterpret_cast<uint32_t *>(image + offsets[0]);
+    auto *sourceOffsets = reinterpret_cast<uint64_t *>(image + offsets[1]);
+    auto *destinations  = reinterpret_cast<uint32_t *>(image + offsets[2]);
+
+    uint64_t source = 0;
+
+    for (std::size_t r = 0; r < routeCount; r++) {
+        const Entry &entry = entries[routeFirsts[r]];
+
+        // It checks if this is the first route of the source. If so, the
+        // source is registered with the offset of its first destination.
+        if (r == 0 || entries[routeFirsts[r - 1]].m_Source != entry.m_Source) {
+            sources[source]       = entry.m_Source;
+            sourceOffsets[source] = r;
+            source++;
+        }
+
+        destinations[r] = entry.m_Destination;
+    }
+
+    sourceOffsets[sourceCount] = routeCount;
+
+    std::copy(routeFirsts.begin(),
+              routeFirsts.end(),
+              reinterpret_cast<uint64_t *>(image + offsets[3]));
+    std::copy(pathStarts.begin(),
+              pathStarts.end(),
+              reinterpret_cast<uint64_t *>(image + offsets[4]));
+    std::copy(pathLengths.begin(),
+              pathLengths.end(),
+              reinterpret_cast<uint32_t *>(image + offsets[5]));
+    std::copy(paths.begin(),
+              paths.end(),
+              reinterpret_cast<uint32_t *>(image + offsets[6]));
+
+    rt->attach(image);
+
+    // Release the builder's storage, since the routes have been frozen.
+    m_Entries = std::vector<Entry>();
+    m_Paths   = std::vector<uint32_t>();
+
+    return rt;
+}
+
+/// \brief The least amount of bytes parsed by each thread, such that, small
+///        routing files are not split among many threads.
+static constexpr std::size_t MinChunkSize = 1ULL << 20;
+
+/// \brief Returns true if the specified character separates the identifiers
+///        in a route line.
+ENGINE_INLINE static bool isSeparator(const char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+/// \brief The character that separates the equal-cost alternatives of a
+///        route in a route line.
+static constexpr char AlternativeSeparator = '|';
+
+/// \brief Parses the route lines in the range [first, last), which must
+///        start at a line boundary, adding the routes that are kept by the
+///        filter (if any) to the builder.
+static void parseRoutes(const char          *first,
+                        const char          *last,
+                        const std::string   &filepath,
+                        const RouteFilter   *filter,
+                        RoutingTableBuilder &builder)
+{
+    std::vector<uint32_t>    path;
+    std::vector<std::size_t> ends;
+
+    while (first < last) {
+        const char *lineEnd = static_cast<const char *>(
+            std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+
+        if (!lineEnd)
+            lineEnd = last;
+
+        const char *lineStart = first;
+        std::size_t count     = 0;
+        uint32_t    src       = 0;
+        uint32_t    dest      = 0;
+
+        path.clear();
+        ends.clear();
+
+        // Parse the identifiers of the line. The first identifier is the
+        // source service, the second one is the destination service and the
+        // remaining ones are the route's inner elements. The end of each
+        // alternative, but the last one, is marked by a separator.
+        for (const char *it = lineStart;;) {
+            while (it < lineEnd && isSeparator(*it))
+                it++;
+
+            if (it == lineEnd)
+                break;
+
+            // It checks if an alternative ends here. An alternative may only
+            // end after the source and destination services, and after at
+            // least one element of its own.
+            if (*it == AlternativeSeparator) {
+                if (UNLIKELY(count < 2 ||
+                             path.size() == (ends.empty() ? 0 : ends.back())))
+                    die("Routing file '%s' has an invalid route '%.*s'.",
+                        filepath.c_str(),
+                        static_cast<int>(lineEnd - lineStart),
+                        lineStart);
+
+                ends.push_back(path.size());
+                it++;
+                continue;
+            }
+
+            uint32_t   id = 0;
+            const auto result = std::from_chars(it, lineEnd, id);
+
+            // It checks if the identifier is invalid. If so, the program is
+            // immediately aborted.
+            if (UNLIKELY(result.ec != std::errc() ||
+                         (result.ptr < lineEnd && !isSeparator(*result.ptr) &&
+                          *result.ptr != AlternativeSeparator)))
+                die("Routing file '%s' has an invalid route '%.*s'.",
+                    filepath.c_str(),
+                    static_cast<int>(lineEnd - lineStart),
+                    lineStart);
+
+            if (count == 0)
+                src = id;
+            else if (count == 1)
+                dest = id;
+            else
+                path.push_back(id);
+
+            count++;
+            it = result.ptr;
+        }
+
+        first = lineEnd + 1;
+
+        // The blank lines are skipped.
+        if (count == 0)
+            continue;
+
+        // It checks if the route has no destination. If so, the program is
+        // immediately aborted.
+        if (UNLIKELY(count == 1))
+            die("Routing file '%s' has a route with no destination '%.*s'.",
+                filepath.c_str(),
+                static_cast<int>(lineEnd - lineStart),
+                lineStart);
+
+        // It checks if the last alternative has no element, that is, the
+        // line ends with a separator. If so, the program is immediately
+        // aborted.
+        if (UNLIKELY(!ends.empty() && path.size() == ends.back()))
+            die("Routing file '%s' has an invalid route '%.*s'.",
+                filepath.c_str(),
+                static_cast<int>(lineEnd - lineStart),
+                lineStart);
+
+        ends.push_back(path.size());
+
+        // It checks if the route is discarded by the filter. If so, it is not
+        // even stored in the builder.
+        if (filter && !(*filter)(src, dest, path.data(), path.size()))
+            continue;
+
+        // The first alternative replaces any route previously defined to the
+        // same source and destination services, and the following ones are
+        // added to it.
+        for (std::size_t i = 0, start = 0; i < ends.size(); start = ends[i++]) {
+            const std::size_t length = ends[i] - start;
+
+            // It checks if the route offsets do not fit in the route
+            // descriptor. If so, the program is immediately aborted.
+            if (UNLIKELY(length > RouteMaxLength))
+                die("Route with %zu services is longer than the greatest "
+                    "route length supported (%zu).",
+                    length,
+                    RouteMaxLength);
+
+            const uint32_t *alternative = path.data() + start;
+
+            if (i == 0)
+                builder.addRoute(src, dest, length, alternative);
+            else
+                builder.addEqualCostPath(src, dest, length, alternative);
+        }
+    }
+}
+
+RoutingTable *RoutingTableReader::read(const std::string &filepath,
+                                       unsigned           threads)
+{
+    return read(filepath, RouteFilter(), threads);
+}
+
+RoutingTable *RoutingTableReader::read(const std::string &filepath,
+                                       const RouteFilter &filter,
+                                       unsigned           threads)
+{
+    const int fd = open(filepath.c_str(), O_RDONLY);
+
+    // It checks if the file could not be opened for some reason. If so,
+    // then the program is immediately aborted.
+    if (fd < 0)
+        die("Routing file '%s' could not be opened", filepath.c_str());
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+        die("Routing file '%s' could not be inspected", filepath.c_str());
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+
+    // An empty file has no routes. It is handled apart, since an empty file
+    // cannot be mapped.
+    if (size == 0) {
+        close(fd);
+        return RoutingTableBuilder().build();
+    }
+
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+        die("Routing file '%s' could not be mapped", filepath.c_str());
+
+    const char *buffer = static_cast<const char *>(mapping);
+
+    // It checks if the file is a binary routing file. If so, it is used in
+    // place instead of being parsed.
+    if (size >= sizeof(RoutingFileMagic) &&
+        std::memcmp(buffer, RoutingFileMagic, sizeof(RoutingFileMagic)) == 0) {
+        munmap(mapping, size);
+
+        RoutingTable *rt = RoutingTable::map(filepath);
+
+        if (!filter)
+            return rt;
+
+        RoutingTable *shard = rt->filter(filter);
+        delete rt;
+        return shard;
+    }
+
+    madvise(mapping, size, MADV_SEQUENTIAL);
+
+    if (threads == 0U)
+        threads = std::max(1U, std::thread::hardware_concurrency());
+
+    // Small files are parsed by fewer threads, such that, each thread parses
+    // at least `MinChunkSize` bytes.
+    const std::size_t chunks = std::max<std::size_t>(1ULL, size / MinChunkSize);
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, chunks));
+
+    // Split the file in chunks of similar sizes at line boundaries. Each
+    // chunk starts right after a new line, except the first one.
+    std::vector<const char *> bounds(threads + 1);
+    bounds[0]       = buffer;
+    bounds[threads] = buffer + size;
+
+    for (unsigned i = 1; i < threads; i++) {
+        const char *bound = buffer + size * i / threads;
+        bound             = std::max(bounds[i - 1], bound);
+
+        const char *lineEnd = static_cast<const char *>(std::memchr(
+            bound, '\n', static_cast<std::size_t>(buffer + size - bound)));
+
+        bounds[i] = lineEnd ? lineEnd + 1 : buffer + size;
+    }
+
+    // Parse the chunks in parallel. Each thread has its own builder, which
+    // are merged in the chunks' order, such that, the result is the same as
+    // if the file had been parsed sequentially.
+    std::vector<RoutingTableBuilder> builders(threads);
+    std::vector<std::thread>         workers;
+
+    for (unsigned i = 1; i < threads; i++)
+        workers.emplace_back(parseRoutes,
+                             bounds[i],
+                             bounds[i + 1],
+                             std::cref(filepath),
+                             filter ? &filter : nullptr,
+                             std::ref(builders[i]));
+
+    parseRoutes(bounds[0],
+                bounds[1],
+                filepath,
+                filter ? &filter : nullptr,
+                builders[0]);
+
+    for (std::thread &worker : workers)
+        worker.join();
+
+    munmap(mapping, size);
+
+    for (unsigned i = 1; i < threads; i++)
+        builders[0].addRoutes(builders[i]);
+
+    return builders[0].build();
+}
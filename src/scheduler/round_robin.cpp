@@ -1,10 +1,8 @@
 #include <math/utility.hpp>
-#include <routing/table.hpp>
 #include <scheduler/round_robin.hpp>
+#include <service/cluster.hpp>
 #include <service/master.hpp>
 
-extern RoutingTable *g_RoutingTable;
-
 void RoundRobin::onInit()
 {
     Workload *workload = m_Master->getWorkload();
@@ -15,9 +13,15 @@ void RoundRobin::onInit()
     if (!workload)
         return;
 
+    std::vector<SourceRoutedEvent>    events;
+    std::vector<ispd::ScheduledEvent> batch;
+
+    events.reserve(m_Resources.size());
+    batch.reserve(m_Resources.size());
+
     for (int i = 0; i < m_Resources.size(); i++) {
         if (UNLIKELY(!workload->hasRemainingWorkload()))
-            return;
+            break;
 
         const sid_t    masterId = m_Master->getId();
         const uint64_t taskId =
@@ -28,23 +32,40 @@ void RoundRobin::onInit()
 
         workload->setTaskWorkload(processingSize, communicationSize);
 
-        const sid_t  scheduledSlave = schedule();
-        const Route *route = g_RoutingTable->getRoute(masterId, scheduledSlave);
+        const sid_t scheduledSlave = schedule();
+
+        Task scheduledTask(taskId, masterId, processingSize, communicationSize);
+        scheduledTask.setMember(getSlaveMember(scheduledSlave));
+
+        const SourceRoutedEvent &e = events.emplace_back(
+            scheduledTask,
+            RouteDescriptor(masterId,
+                            getSlaveServiceId(scheduledSlave),
+                            masterId,
+                            1ULL,
+                            true));
 
-        Event e(
-            Task(taskId, masterId, processingSize, communicationSize),
-            RouteDescriptor(masterId, scheduledSlave, masterId, 1ULL, true));
+        const uint32_t next =
+            g_ForwardingTable ? e.getNextHop(masterId) : e.getHop(0);
 
-        /* Schedule the event to the scheduled slave */
-        ispd::schedule_event((*route)[0], 0.0, TASK_ARRIVAL, &e, sizeof(e));
+        // The events' storage has been reserved up front, therefore, the
+        // event content is never moved while the batch is being prepared.
+        batch.push_back(
+            ispd::ScheduledEvent{next, 0.0, TASK_ARRIVAL, &e, e.getSize()});
     }
+
+    /* Schedule the events to the scheduled slaves */
+    ispd::schedule_events(batch.data(), batch.size());
 }
 
 void RoundRobin::onCompletedTask(const timestamp_t now,
                                  const uint64_t    slaveId,
                                  const Task       &task)
 {
-    if (UNLIKELY(!m_Master->m_Workload->hasRemainingWorkload()))
+    // If the master does not have workload, the completed task has been
+    // injected in it and there is no task to be scheduled in its place.
+    if (UNLIKELY(!m_Master->m_Workload ||
+                 !m_Master->m_Workload->hasRemainingWorkload()))
         return;
 
     const sid_t    masterId = m_Master->getId();
@@ -56,12 +77,44 @@ void RoundRobin::onCompletedTask(const timestamp_t now,
 
     m_Master->m_Workload->setTaskWorkload(processingSize, communicationSize);
 
-    const sid_t  scheduledSlave = schedule();
-    const Route *route = g_RoutingTable->getRoute(masterId, scheduledSlave);
+    const sid_t scheduledSlave = schedule();
+
+    Task scheduledTask(taskId, masterId, processingSize, communicationSize);
+    scheduledTask.setMember(getSlaveMember(scheduledSlave));
 
-    Event e(Task(taskId, masterId, processingSize, communicationSize),
-            RouteDescriptor(masterId, scheduledSlave, masterId, 1ULL, true));
+    SourceRoutedEvent e(scheduledTask,
+                        RouteDescriptor(masterId,
+                                        getSlaveServiceId(scheduledSlave),
+                                        masterId,
+                                        1ULL,
+                                        true));
+
+    const uint32_t next =
+        g_ForwardingTable ? e.getNextHop(masterId) : e.getHop(0);
 
     /* Schedule the event to the scheduled slave */
-    ispd::schedule_event((*route)[0], now, TASK_ARRIVAL, &e, sizeof(e));
+    ispd::schedule_event(next, now, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void RoundRobin::onInitReverse(const int tasks)
+{
+    Workload *workload = m_Master->getWorkload();
+
+    // Every task scheduled in the initialization has been taken from the
+    // workload and has been sent to the next resource in the circular queue.
+    for (int i = 0; i < tasks; i++) {
+        workload->setTaskWorkloadReverse();
+        scheduleReverse();
+    }
+}
+
+void RoundRobin::onCompletedTaskReverse(const timestamp_t now,
+                                        const uint64_t    slaveId,
+                                        const Task       &task,
+                                        const int         tasks)
+{
+    for (int i = 0; i < tasks; i++) {
+        m_Master->m_Workload->setTaskWorkloadReverse();
+        scheduleReverse();
+    }
 }
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <service/cluster.hpp>
+
+/**
+ * @brief The cluster's values overwritten by the task request handler.
+ */
+struct ClusterRequestReverseData
+{
+    timestamp_t m_LinkAvailableTime;
+    double      m_CommMBits;
+    double      m_CommTime;
+    timestamp_t m_LastActivityTime;
+    double      m_ProcMFlops;
+    double      m_ProcTime;
+    timestamp_t m_CoreFreeTime;
+    int         m_CoreIndex;
+};
+
+/**
+ * @brief The cluster's values overwritten by the task completion handler.
+ */
+struct ClusterCompletionReverseData
+{
+    timestamp_t m_LinkAvailableTime;
+    double      m_CommMBits;
+    double      m_CommTime;
+};
+
+void Cluster::onTaskArrival(const timestamp_t time, const Event *event)
+{
+    const auto &routeDescriptor = event->getRouteDescriptor();
+
+    // It checks if the packet's destination is not this cluster. If so, the
+    // program is immediately aborted, since the clusters do not forward
+    // packets.
+    if (UNLIKELY(routeDescriptor.getDestination() != getId()))
+        die("Cluster with id %llu has received a packet destined to %llu, but "
+            "the clusters do not forward packets.",
+            getId(),
+            routeDescriptor.getDestination());
+
+    if (UNLIKELY(event->getTask().getMember() >= m_Machines))
+        die("Cluster with id %llu has received a task scheduled to its "
+            "machine %u, but it only has %u machines.",
+            getId(),
+            event->getTask().getMember(),
+            m_Machines);
+
+    // A task that travels in the forward direction has been scheduled to one
+    // of the machines, whereas a task that travels back has been processed by
+    // one of them and has been sent by the cluster to itself.
+    if (routeDescriptor.getForwardingDirection())
+        onTaskRequest(time, event);
+    else
+        onTaskCompletion(time, event);
+}
+
+void Cluster::onTaskRequest(const timestamp_t time, const Event *event)
+{
+    const Task    &task   = event->getTask();
+    const uint32_t member = task.getMember();
+
+    auto &linkMetrics    = m_LinkMetrics[member];
+    auto &machineMetrics = m_MachineMetrics[member];
+
+    // Save the values to be restored if this event is reversed.
+    auto *saved = ispd::reverse_data<ClusterRequestReverseData>();
+    saved->m_LinkAvailableTime = m_LinkAvailableTimes[member];
+    saved->m_CommMBits         = linkMetrics.m_CommMBits;
+    saved->m_CommTime          = linkMetrics.m_CommTime;
+    saved->m_LastActivityTime  = machineMetrics.m_LastActivityTime;
+    saved->m_ProcMFlops        = machineMetrics.m_ProcMFlops;
+    saved->m_ProcTime          = machineMetrics.m_ProcTime;
+
+    // The task is communicated by the machine's access link.
+    const double      commSize = task.getCommunicationSize();
+    const double      commTime = timeToCommunicate(commSize);
+    const timestamp_t arrivalTime =
+        time + std::max(0.0, m_LinkAvailableTimes[member] - time) + commTime;
+
+    m_LinkAvailableTimes[member] = arrivalTime;
+    linkMetrics.m_CommMBits     += commSize;
+    linkMetrics.m_CommTime      += commTime;
+    linkMetrics.m_CommTasks++;
+
+    // Then, the task is processed by the machine's core that becomes free the
+    // earliest.
+    const double procSize = task.getProcessingSize();
+    const double procTime = timeToProcess(procSize);
+
+    machineMetrics.m_LastActivityTime = arrivalTime;
+    machineMetrics.m_ProcMFlops      += procSize;
+    machineMetrics.m_ProcTime        += procTime;
+    machineMetrics.m_ProcTasks++;
+
+    timestamp_t *coreFreeTimes =
+        m_CoreFreeTimes + static_cast<std::size_t>(member) * m_Cores;
+
+    const int         coreIndex     = findEarliestCore(coreFreeTimes, m_Cores);
+    const timestamp_t leastCoreTime = coreFreeTimes[coreIndex];
+    const timestamp_t departureTime =
+        arrivalTime + std::max(0.0, leastCoreTime - arrivalTime) + procTime;
+
+    saved->m_CoreIndex       = coreIndex;
+    saved->m_CoreFreeTime    = leastCoreTime;
+    coreFreeTimes[coreIndex] = departureTime;
+
+    const auto &routeDescriptor = event->getRouteDescriptor();
+
+    // The processed task is sent to the cluster itself, such that, it is
+    // communicated back by the access link at its departure time. The route
+    // descriptor keeps the service from which the task has arrived, to which
+    // the task is sent back.
+    const std::size_t offset =
+        g_ForwardingTable ? 0ULL : routeDescriptor.getOffset() - 2ULL;
+
+    Task processed(task.getTid(),
+                   task.getOrigin(),
+                   task.getProcessingSize(),
+                   task.getCommunicationSize(),
+                   TaskCompletionState::PROCESSED);
+    processed.setMember(task.getMember());
+
+    SourceRoutedEvent e(processed,
+                        RouteDescriptor(routeDescriptor.getSource(),
+                                        routeDescriptor.getDestination(),
+                                        routeDescriptor.getPreviousService(),
+                                        offset,
+                                        false),
+                        *event);
+
+    ispd::schedule_event(
+        getId(), departureTime, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void Cluster::onTaskCompletion(const timestamp_t time, const Event *event)
+{
+    const Task    &task   = event->getTask();
+    const uint32_t member = task.getMember();
+
+    auto &linkMetrics = m_LinkMetrics[member];
+
+    // Save the values to be restored if this event is reversed.
+    auto *saved = ispd::reverse_data<ClusterCompletionReverseData>();
+    saved->m_LinkAvailableTime = m_LinkAvailableTimes[member];
+    saved->m_CommMBits         = linkMetrics.m_CommMBits;
+    saved->m_CommTime          = linkMetrics.m_CommTime;
+
+    // The processed task is communicated back by the machine's access link.
+    const double      commSize = task.getCommunicationSize();
+    const double      commTime = timeToCommunicate(commSize);
+    const timestamp_t departureTime =
+        time + std::max(0.0, m_LinkAvailableTimes[member] - time) + commTime;
+
+    m_LinkAvailableTimes[member] = departureTime;
+    linkMetrics.m_CommMBits     += commSize;
+    linkMetrics.m_CommTime      += commTime;
+    linkMetrics.m_CommTasks++;
+
+    const auto &routeDescriptor = event->getRouteDescriptor();
+
+    SourceRoutedEvent e(task,
+                        RouteDescriptor(routeDescriptor.getSource(),
+                                        routeDescriptor.getDestination(),
+                                        getId(),
+                                        routeDescriptor.getOffset(),
+                                        false),
+                        *event);
+
+    const sid_t next = g_ForwardingTable ? e.getNextHop(getId())
+                                         : routeDescriptor.getPreviousService();
+
+    ispd::schedule_event(next, departureTime, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void Cluster::onTaskArrivalReverse(const timestamp_t time, const Event *event)
+{
+    const uint32_t member = event->getTask().getMember();
+
+    auto &linkMetrics = m_LinkMetrics[member];
+
+    if (!event->getRouteDescriptor().getForwardingDirection()) {
+        const auto *saved = ispd::reverse_data<ClusterCompletionReverseData>();
+
+        m_LinkAvailableTimes[member] = saved->m_LinkAvailableTime;
+        linkMetrics.m_CommMBits      = saved->m_CommMBits;
+        linkMetrics.m_CommTime       = saved->m_CommTime;
+        linkMetrics.m_CommTasks--;
+        return;
+    }
+
+    const auto *saved = ispd::reverse_data<ClusterRequestReverseData>();
+
+    auto &machineMetrics = m_MachineMetrics[member];
+
+    m_LinkAvailableTimes[member] = saved->m_LinkAvailableTime;
+    linkMetrics.m_CommMBits      = saved->m_CommMBits;
+    linkMetrics.m_CommTime       = saved->m_CommTime;
+    linkMetrics.m_CommTasks--;
+
+    machineMetrics.m_LastActivityTime = saved->m_LastActivityTime;
+    machineMetrics.m_ProcMFlops       = saved->m_ProcMFlops;
+    machineMetrics.m_ProcTime         = saved->m_ProcTime;
+    machineMetrics.m_ProcTasks--;
+
+    m_CoreFreeTimes[static_cast<std::size_t>(member) * m_Cores +
+                    saved->m_CoreIndex] = saved->m_CoreFreeTime;
+}
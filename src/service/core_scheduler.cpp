@@ -0,0 +1,193 @@
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <service/core_scheduler.hpp>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ENGINE_X86_KERNELS
+#endif
+
+int findEarliestCoreScalar(const timestamp_t *const freeTimes,
+                           const int                cores)
+{
+    int earliest = 0;
+
+    // The comparison is compiled to a conditional move instead of a branch,
+    // whose outcome would be hard to predict.
+    for (int i = 1; i < cores; i++)
+        earliest = freeTimes[i] < freeTimes[earliest] ? i : earliest;
+
+    return earliest;
+}
+
+#ifdef ENGINE_X86_KERNELS
+
+/// \brief Finds the earliest core in a single pass, comparing four free times
+///        at once.
+///
+/// Each lane keeps the least free time among the cores that are congruent to
+/// the lane modulo four, along with the first index in which it has been
+/// found. The lanes are then reduced, breaking the ties by the least index,
+/// such that, the same core is selected as by the scalar kernel.
+__attribute__((target("avx2"))) static int
+findEarliestCoreAvx2(const timestamp_t *const freeTimes, const int cores)
+{
+    if (cores < 4)
+        return findEarliestCoreScalar(freeTimes, cores);
+
+    const __m256d step     = _mm256_set1_pd(4.0);
+    __m256d       indices  = _mm256_set_pd(3.0, 2.0, 1.0, 0.0);
+    __m256d       least    = _mm256_loadu_pd(freeTimes);
+    __m256d       earliest = indices;
+    int           i        = 4;
+
+    for (; i + 4 <= cores; i += 4) {
+        const __m256d times = _mm256_loadu_pd(freeTimes + i);
+        const __m256d less  = _mm256_cmp_pd(times, least, _CMP_LT_OQ);
+
+        indices  = _mm256_add_pd(indices, step);
+        least    = _mm256_blendv_pd(least, times, less);
+        earliest = _mm256_blendv_pd(earliest, indices, less);
+    }
+
+    alignas(32) double laneTimes[4];
+    alignas(32) double laneCores[4];
+
+    _mm256_store_pd(laneTimes, least);
+    _mm256_store_pd(laneCores, earliest);
+
+    int core = static_cast<int>(laneCores[0]);
+
+    for (int lane = 1; lane < 4; lane++) {
+        const int index = static_cast<int>(laneCores[lane]);
+
+        if (laneTimes[lane] < freeTimes[core] ||
+            (laneTimes[lane] == freeTimes[core] && index < core))
+            core = index;
+    }
+
+    for (; i < cores; i++)
+        core = freeTimes[i] < freeTimes[core] ? i : core;
+
+    return core;
+}
+
+/// \brief Finds the earliest core as `findEarliestCoreAvx2`, comparing eight
+///        free times at once.
+__attribute__((target("avx512f"))) static int
+findEarliestCoreAvx512(const timestamp_t *const freeTimes, const int cores)
+{
+    if (cores < 8)
+        return findEarliestCoreAvx2(freeTimes, cores);
+
+    __m512d indices =
+        _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+
+    const __m512d step     = _mm512_set1_pd(8.0);
+    __m512d       least    = _mm512_loadu_pd(freeTimes);
+    __m512d       earliest = indices;
+    int           i        = 8;
+
+    for (; i + 8 <= cores; i += 8) {
+        const __m512d  times = _mm512_loadu_pd(freeTimes + i);
+        const __mmask8 less  = _mm512_cmp_pd_mask(times, least, _CMP_LT_OQ);
+
+        indices  = _mm512_add_pd(indices, step);
+        least    = _mm512_mask_blend_pd(less, least, times);
+        earliest = _mm512_mask_blend_pd(less, earliest, indices);
+    }
+
+    // The least free time is reduced first and, then, the least index among
+    // the lanes that hold it.
+    const double   time = _mm512_reduce_min_pd(least);
+    const __mmask8 ties =
+        _mm512_cmp_pd_mask(least, _mm512_set1_pd(time), _CMP_EQ_OQ);
+    const __m512d candidates = _mm512_mask_blend_pd(
+        ties, _mm512_set1_pd(static_cast<double>(cores)), earliest);
+
+    int core = static_cast<int>(_mm512_reduce_min_pd(candidates));
+
+    for (; i < cores; i++)
+        core = freeTimes[i] < freeTimes[core] ? i : core;
+
+    return core;
+}
+
+#endif // ENGINE_X86_KERNELS
+
+/// \brief A kernel that finds the earliest core, along with the crossovers
+///        measured for it by the core selection benchmark.
+struct EarliestCoreKernel
+{
+    const char *m_Name;
+    int (*m_Function)(const timestamp_t *, int);
+
+    /// \brief The least amount of cores for which the kernel is faster than
+    ///        the scalar kernel.
+    int m_VectorThreshold;
+
+    /// \brief The greatest amount of cores for which the linear scan is
+    ///        faster than the tournament tree.
+    int m_TournamentThreshold;
+};
+
+/// \brief Selects the widest kernel supported by the processor.
+///
+/// The `ENGINE_CORE_KERNEL` environment variable may be set to `avx2` or to
+/// `scalar` to select a narrower kernel, such that, the crossovers of every
+/// kernel can be measured on the same processor.
+static EarliestCoreKernel selectKernel()
+{
+    const char *requested = std::getenv("ENGINE_CORE_KERNEL");
+    const bool  scalar    = requested && std::strcmp(requested, "scalar") == 0;
+    const bool  avx2      = requested && std::strcmp(requested, "avx2") == 0;
+
+#ifdef ENGINE_X86_KERNELS
+    // The processor's features must be queried explicitly, since this
+    // function is called during the static initialization.
+    __builtin_cpu_init();
+
+    if (!scalar && !avx2 && __builtin_cpu_supports("avx512f"))
+        return {"AVX-512", findEarliestCoreAvx512, 32, 128};
+
+    // The AVX2 kernel only beats the scalar one from 64 cores on, when the
+    // tournament tree is already faster than both.
+    if (!scalar && __builtin_cpu_supports("avx2"))
+        return {"AVX2", findEarliestCoreAvx2, 64, 16};
+#else
+    (void)scalar;
+    (void)avx2;
+#endif
+
+    return {"scalar", findEarliestCoreScalar, INT_MAX, 16};
+}
+
+static const EarliestCoreKernel s_Kernel = selectKernel();
+
+int findEarliestCore(const timestamp_t *const freeTimes, const int cores)
+{
+    // Below the threshold, the scalar kernel is faster, since the free time
+    // that has just been stored by the machine cannot be forwarded to a
+    // vector load of the same memory.
+    if (cores < s_Kernel.m_VectorThreshold)
+        return findEarliestCoreScalar(freeTimes, cores);
+
+    return s_Kernel.m_Function(freeTimes, cores);
+}
+
+int findEarliestCoreVector(const timestamp_t *const freeTimes,
+                           const int                cores)
+{
+    return s_Kernel.m_Function(freeTimes, cores);
+}
+
+const char *getEarliestCoreKernelName()
+{
+    return s_Kernel.m_Name;
+}
+
+int getTournamentThreshold()
+{
+    return s_Kernel.m_TournamentThreshold;
+}
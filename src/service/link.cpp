@@ -1,43 +1,72 @@
 #include <algorithm>
 #include <service/link.hpp>
 
+/**
+ * @brief The link's values overwritten by the task arrival handler.
+ */
+struct LinkReverseData
+{
+    timestamp_t m_AvailableTime;
+    double      m_CommMBits;
+    double      m_CommTime;
+};
+
 void Link::onTaskArrival(timestamp_t now, const Event *event)
 {
+    const auto         &routeDescriptor = event->getRouteDescriptor();
+    const LinkDirection direction       = getDirection(event);
+    const sid_t sendTo = direction == LinkDirection::FROM_TO ? m_To : m_From;
+
+    // In the full-duplex mode, the packet only waits for the packets in the
+    // same direction. Otherwise, both directions share the first queue.
+    const int    queue   = getQueue(direction);
+    LinkMetrics &metrics = m_Metrics[static_cast<int>(direction)];
+
     const Task  &task     = event->getTask();
     const double commSize = task.getCommunicationSize();
     const double commTime = timeToCommunicate(commSize);
 
-    const timestamp_t waitingTime   = std::max(0.0, m_AvailableTime - now);
-    const timestamp_t departureTime = now + waitingTime + commTime;
-
-    m_AvailableTime        = departureTime;
-    m_Metrics.m_CommMBits += commSize;
-    m_Metrics.m_CommTime  += commTime;
-    m_Metrics.m_CommTasks++;
+    /* Save the values to be restored if this event is reversed */
+    LinkReverseData *saved = ispd::reverse_data<LinkReverseData>();
+    saved->m_AvailableTime = m_AvailableTime[queue];
+    saved->m_CommMBits     = metrics.m_CommMBits;
+    saved->m_CommTime      = metrics.m_CommTime;
 
-    m_Lvt = departureTime;
+    const timestamp_t waitingTime =
+        std::max(0.0, m_AvailableTime[queue] - now);
+    const timestamp_t departureTime = now + waitingTime + commTime;
 
-    const auto &routeDescriptor = event->getRouteDescriptor();
+    m_AvailableTime[queue]  = departureTime;
+    metrics.m_CommMBits    += commSize;
+    metrics.m_CommTime     += commTime;
+    metrics.m_CommTasks++;
 
     /* Prepare the event */
-    Event e(event->getTask(),
-            RouteDescriptor(routeDescriptor.getSource(),
-                            routeDescriptor.getDestination(),
-                            getId(),
-                            routeDescriptor.getOffset(),
-                            routeDescriptor.getForwardingDirection()));
-
-    sid_t sendTo;
-
-    if (m_From == routeDescriptor.getPreviousService())
-        sendTo = m_To;
-    else if (m_To == routeDescriptor.getPreviousService())
-        sendTo = m_From;
-    else
-        die("Link with id %llu has received a packet from a service different "
-            "from its ends.",
-            getId());
+    SourceRoutedEvent e(
+        event->getTask(),
+        RouteDescriptor(routeDescriptor.getSource(),
+                        routeDescriptor.getDestination(),
+                        getId(),
+                        routeDescriptor.getOffset(),
+                        routeDescriptor.getForwardingDirection()),
+        *event);
 
     /* Send the event to the destination machine */
-    ispd::schedule_event(sendTo, departureTime, TASK_ARRIVAL, &e, sizeof(e));
+    ispd::schedule_event(
+        sendTo, departureTime, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void Link::onTaskArrivalReverse(timestamp_t now, const Event *event)
+{
+    const LinkReverseData *saved = ispd::reverse_data<LinkReverseData>();
+
+    // The direction is obtained again from the packet, as it has been by the
+    // task arrival handler.
+    const LinkDirection direction = getDirection(event);
+    LinkMetrics        &metrics   = m_Metrics[static_cast<int>(direction)];
+
+    m_AvailableTime[getQueue(direction)] = saved->m_AvailableTime;
+    metrics.m_CommMBits                  = saved->m_CommMBits;
+    metrics.m_CommTime                   = saved->m_CommTime;
+    metrics.m_CommTasks--;
 }
@@ -1,36 +1,22 @@
 #include <algorithm>
-#include <routing/table.hpp>
 #include <service/machine.hpp>
 
-extern RoutingTable *g_RoutingTable;
-
-ENGINE_INLINE
-static void doMachinePacketForwarding(const sid_t       machineId,
-                                      const timestamp_t time,
-                                      const Event      *event)
+/// \brief The machine's values overwritten by the task arrival handler.
+struct MachineReverseData
 {
-    const auto &routeDescriptor = event->getRouteDescriptor();
-
-    const auto source           = routeDescriptor.getSource();
-    const auto destination      = routeDescriptor.getDestination();
-    const auto offset           = routeDescriptor.getOffset();
-    const auto forwardDirection = routeDescriptor.getForwardingDirection();
-    const auto newOffset = forwardDirection ? offset + 1ULL : offset - 1ULL;
-
-    // It fetches the routing from the routing table using the source
-    // and destination identifier.
-    const Route *route = g_RoutingTable->getRoute(source, destination);
-
-    // Prepare the event to be send to the next service.
-    Event e(event->getTask(),
-            RouteDescriptor(
-                source, destination, machineId, newOffset, forwardDirection));
-
-    ispd::schedule_event((*route)[offset], time, TASK_ARRIVAL, &e, sizeof(e));
-}
+    timestamp_t m_LastActivityTime;
+    double      m_ProcMFlops;
+    double      m_ProcTime;
+    timestamp_t m_CoreFreeTime;
+    int         m_CoreIndex;
+};
 
 void Machine::onTaskArrival(const timestamp_t time, const Event *event)
 {
+    // Save the values to be restored if this event is reversed.
+    MachineReverseData *saved = ispd::reverse_data<MachineReverseData>();
+    saved->m_LastActivityTime = m_Metrics.m_LastActivityTime;
+
     m_Metrics.m_LastActivityTime = time;
 
     // It checks if the packet destination is not equals to this machine.
@@ -48,6 +34,9 @@ void Machine::onTaskArrival(const timestamp_t time, const Event *event)
     const double procSize = task.getProcessingSize();
     const double procTime = timeToProcess(procSize);
 
+    saved->m_ProcMFlops = m_Metrics.m_ProcMFlops;
+    saved->m_ProcTime   = m_Metrics.m_ProcTime;
+
     m_Metrics.m_ProcMFlops += procSize;
     m_Metrics.m_ProcTime   += procTime;
     m_Metrics.m_ProcTasks++;
@@ -57,24 +46,54 @@ void Machine::onTaskArrival(const timestamp_t time, const Event *event)
     const timestamp_t waitingTime   = std::max(0.0, leastCoreTime - time);
     const timestamp_t departureTime = time + waitingTime + procTime;
 
-    m_CoreFreeTimes[coreIndex] = departureTime;
+    saved->m_CoreIndex    = coreIndex;
+    saved->m_CoreFreeTime = leastCoreTime;
+    m_CoreScheduler.setFreeTime(coreIndex, departureTime);
 
     const auto &routeDescriptor = event->getRouteDescriptor();
 
-    Event e(Task(task.getTid(),
-                 task.getOrigin(),
-                 task.getProcessingSize(),
-                 task.getCommunicationSize(),
-                 TaskCompletionState::PROCESSED),
-            RouteDescriptor(routeDescriptor.getSource(),
-                            routeDescriptor.getDestination(),
-                            getId(),
-                            routeDescriptor.getOffset() - 2ULL,
-                            false));
-
-    ispd::schedule_event(routeDescriptor.getPreviousService(),
-                         departureTime,
-                         TASK_ARRIVAL,
-                         &e,
-                         sizeof(e));
+    // The processed task travels the route back to its source. Through the
+    // forwarding table, each service only needs the route's source, and the
+    // route's offset is not used at all.
+    const std::size_t offset =
+        g_ForwardingTable ? 0ULL : routeDescriptor.getOffset() - 2ULL;
+
+    SourceRoutedEvent e(Task(task.getTid(),
+                             task.getOrigin(),
+                             task.getProcessingSize(),
+                             task.getCommunicationSize(),
+                             TaskCompletionState::PROCESSED),
+                        RouteDescriptor(routeDescriptor.getSource(),
+                                        routeDescriptor.getDestination(),
+                                        getId(),
+                                        offset,
+                                        false),
+                        *event);
+
+    const sid_t next = g_ForwardingTable ? e.getNextHop(getId())
+                                         : routeDescriptor.getPreviousService();
+
+    ispd::schedule_event(next, departureTime, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void Machine::onTaskArrivalReverse(const timestamp_t time, const Event *event)
+{
+    const MachineReverseData *saved = ispd::reverse_data<MachineReverseData>();
+
+    m_Metrics.m_LastActivityTime = saved->m_LastActivityTime;
+
+    // It checks if the packet has been forwarded by the machine. If so, only
+    // the forwarded packets counter has to be reversed.
+    if (event->getRouteDescriptor().getDestination() != getId()) {
+        m_Metrics.m_ForwardedPackets--;
+        return;
+    }
+
+    m_Metrics.m_ProcMFlops = saved->m_ProcMFlops;
+    m_Metrics.m_ProcTime   = saved->m_ProcTime;
+    m_Metrics.m_ProcTasks--;
+
+    // Restoring the core's free time also restores the core scheduler's
+    // tree, which only depends on the free times.
+    m_CoreScheduler.setFreeTime(saved->m_CoreIndex, saved->m_CoreFreeTime);
 }
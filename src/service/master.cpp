@@ -1,16 +1,49 @@
 #include <customer/customer.hpp>
-#include <routing/table.hpp>
+#include <routing/provider.hpp>
+#include <service/cluster.hpp>
 #include <service/master.hpp>
 
-extern RoutingTable *g_RoutingTable;
+/// \brief The master's values overwritten by its event handlers.
+///
+/// The amount of remaining tasks is saved, such that, the reverse handlers
+/// know how many tasks have been taken from the workload by the scheduler.
+struct MasterReverseData
+{
+    timestamp_t m_LastActivityTime;
+    int         m_RemainingTasks;
+};
+
+/// \brief Returns the amount of remaining tasks in the master's workload.
+ENGINE_INLINE static int remainingTasks(const Master *master)
+{
+    return master->m_Workload ? master->m_Workload->getRemainingTasks() : 0;
+}
 
 void Master::onSchedulerInit(timestamp_t now)
 {
+    MasterReverseData *saved = ispd::reverse_data<MasterReverseData>();
+    saved->m_RemainingTasks  = remainingTasks(this);
+
     m_Scheduler->onInit();
+    m_DispatchedTasks += saved->m_RemainingTasks - remainingTasks(this);
+}
+
+void Master::onSchedulerInitReverse(timestamp_t now)
+{
+    const MasterReverseData *saved = ispd::reverse_data<MasterReverseData>();
+    const int tasks = saved->m_RemainingTasks - remainingTasks(this);
+
+    m_DispatchedTasks -= tasks;
+    m_Scheduler->onInitReverse(tasks);
 }
 
 void Master::onTaskArrival(timestamp_t time, const Event *event)
 {
+    // Save the values to be restored if this event is reversed.
+    MasterReverseData *saved  = ispd::reverse_data<MasterReverseData>();
+    saved->m_LastActivityTime = m_Metrics.m_LastActivityTime;
+    saved->m_RemainingTasks   = remainingTasks(this);
+
     m_Metrics.m_LastActivityTime = time;
 
     if (event->getTask().getCompletionState() ==
@@ -27,9 +60,13 @@ void Master::onTaskArrival(timestamp_t time, const Event *event)
             const Task            &task = event->getTask();
             const RouteDescriptor &routeDescriptor =
                 event->getRouteDescriptor();
-            const sid_t slaveId = routeDescriptor.getDestination();
+            const sid_t            slaveId =
+                makeClusterSlaveId(routeDescriptor.getDestination(),
+                                   task.getMember());
 
             m_Scheduler->onCompletedTask(time, slaveId, task);
+            m_DispatchedTasks +=
+                saved->m_RemainingTasks - remainingTasks(this);
             return;
         }
         // In this case, we have a processed task in which its origin is
@@ -40,40 +77,99 @@ void Master::onTaskArrival(timestamp_t time, const Event *event)
         // whcih that is the origin of the task. However, the destination
         // of the route descriptor is changed for this master's identifier.
         else {
-            const auto &routeDescriptor = event->getRouteDescriptor();
-            const auto  offset          = routeDescriptor.getOffset();
-            const auto  forwardingDirection =
-                routeDescriptor.getForwardingDirection();
-            const auto newOffset =
-                forwardingDirection ? offset + 1ULL : offset - 1ULL;
+            const sid_t    origin = event->getTask().getOrigin();
+            const uint64_t tid    = event->getTask().getTid();
+
+            // The task carries the cluster's machine that has been scheduled
+            // by this master, which is meaningless to the origin master.
+            Task task = event->getTask();
+            task.setMember(0U);
+
+            // The packet travels the route from the origin master to this
+            // master backwards, therefore, the first service to receive it
+            // is the last one in the route. Through the forwarding table,
+            // the route's offset is not used at all.
+            const std::size_t offset =
+                g_ForwardingTable
+                    ? 1ULL
+                    : g_RouteProvider->getLength(origin, getId(), tid) - 1ULL;
 
             /* Prepare the event */
-            Event e(event->getTask(),
-                    RouteDescriptor(event->getTask().getOrigin(),
-                                    getId(),
-                                    getId(),
-                                    newOffset,
-                                    false));
-
-            const Route *route =
-                g_RoutingTable->getRoute(event->getTask().getOrigin(), getId());
-
-            /* Schedule the event to the scheduled slave */
-            ispd::schedule_event(
-                (*route)[offset], time, TASK_ARRIVAL, &e, sizeof(e));
+            SourceRoutedEvent e(
+                task,
+                RouteDescriptor(
+                    origin, getId(), getId(), offset - 1ULL, false));
+
+            const uint32_t next = g_ForwardingTable ? e.getNextHop(getId())
+                                                    : e.getHop(offset);
+
+            /* Schedule the event to the origin master */
+            ispd::schedule_event(next, time, TASK_ARRIVAL, &e, e.getSize());
             return;
         }
     }
 
+    // An unprocessed task whose origin is this master has been injected in
+    // it, since the tasks taken from the workload are sent to the slaves.
+    if (event->getTask().getOrigin() == getId())
+        m_PendingArrivals--;
+
     /* Schedule the slave which will receive the task */
     sid_t scheduledSlave = m_Scheduler->schedule();
+    m_DispatchedTasks++;
+
+    // The task carries the scheduled machine if the slave is a cluster's
+    // machine, in which case the task is sent to the cluster itself.
+    Task task = event->getTask();
+    task.setMember(getSlaveMember(scheduledSlave));
 
     /* Prepare the event */
-    Event e(event->getTask(),
-            RouteDescriptor(getId(), scheduledSlave, getId(), 1ULL, true));
+    SourceRoutedEvent e(task,
+                        RouteDescriptor(getId(),
+                                        getSlaveServiceId(scheduledSlave),
+                                        getId(),
+                                        1ULL,
+                                        true));
 
-    const Route *route = g_RoutingTable->getRoute(getId(), scheduledSlave);
+    const uint32_t next =
+        g_ForwardingTable ? e.getNextHop(getId()) : e.getHop(0);
 
     /* Schedule the event to the scheduled slave */
-    ispd::schedule_event((*route)[0], time, TASK_ARRIVAL, &e, sizeof(e));
+    ispd::schedule_event(next, time, TASK_ARRIVAL, &e, e.getSize());
+}
+
+void Master::onTaskArrivalReverse(timestamp_t time, const Event *event)
+{
+    const MasterReverseData *saved = ispd::reverse_data<MasterReverseData>();
+
+    m_Metrics.m_LastActivityTime = saved->m_LastActivityTime;
+
+    // It checks if the task has been scheduled to a slave, that is, the task
+    // has not been processed yet. If so, the slave scheduling is reversed.
+    if (event->getTask().getCompletionState() !=
+        TaskCompletionState::PROCESSED) {
+        m_Scheduler->scheduleReverse();
+        m_DispatchedTasks--;
+
+        if (event->getTask().getOrigin() == getId())
+            m_PendingArrivals++;
+
+        return;
+    }
+
+    m_Metrics.m_CompletedTasks--;
+
+    // It checks if the completed task has been originated by this master. If
+    // so, the tasks taken from the workload upon its completion are given
+    // back. Otherwise, the task has been only forwarded to its origin.
+    if (event->getTask().getOrigin() == getId()) {
+        const sid_t slaveId =
+            makeClusterSlaveId(event->getRouteDescriptor().getDestination(),
+                               event->getTask().getMember());
+        const int tasks = saved->m_RemainingTasks - remainingTasks(this);
+
+        m_DispatchedTasks -= tasks;
+        m_Scheduler->onCompletedTaskReverse(
+            time, slaveId, event->getTask(), tasks);
+    }
 }
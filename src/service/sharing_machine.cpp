@@ -0,0 +1,300 @@
+#include <algorithm>
+#include <cstring>
+#include <service/sharing_machine.hpp>
+
+/**
+ * @brief The processor-sharing machine's values overwritten by the task
+ *        arrival handler.
+ */
+struct SharingMachineArrivalReverseData
+{
+    timestamp_t m_LastActivityTime;
+    double      m_ProcMFlops;
+    double      m_ProcTime;
+    double      m_VirtualTime;
+    timestamp_t m_UpdateTime;
+    uint32_t    m_Position;
+};
+
+/**
+ * @brief The processor-sharing machine's values overwritten by the task
+ *        departure handler. The virtual time bookkeeping is restored from the
+ *        departure itself.
+ */
+struct SharingMachineDepartureReverseData
+{
+    SharingJob m_Job;
+    uint32_t   m_Position;
+};
+
+/**
+ * @brief The position saved by a departure that has been ignored, because it
+ *        has become stale.
+ */
+static constexpr uint32_t StaleDeparture = UINT32_MAX;
+
+void SharingMachine::onTaskArrival(const timestamp_t time, const Event *event)
+{
+    // Save the values to be restored if this event is reversed.
+    auto *saved = ispd::reverse_data<SharingMachineArrivalReverseData>();
+    saved->m_LastActivityTime = m_Metrics.m_LastActivityTime;
+
+    m_Metrics.m_LastActivityTime = time;
+
+    // It checks if the packet destination is not equals to this machine.
+    // Therefore, the packet should be forwarded by the machine to the next
+    // service in the route.
+    if (event->getRouteDescriptor().getDestination() != getId()) {
+        doMachinePacketForwarding(getId(), time, event);
+
+        // Update the machine's metrics.
+        m_Metrics.m_ForwardedPackets++;
+        return;
+    }
+
+    const Task  &task     = event->getTask();
+    const double procSize = task.getProcessingSize();
+    const double procTime = timeToProcess(procSize);
+
+    saved->m_ProcMFlops  = m_Metrics.m_ProcMFlops;
+    saved->m_ProcTime    = m_Metrics.m_ProcTime;
+    saved->m_VirtualTime = m_VirtualTime;
+    saved->m_UpdateTime  = m_UpdateTime;
+
+    m_Metrics.m_ProcMFlops += procSize;
+    m_Metrics.m_ProcTime   += procTime;
+    m_Metrics.m_ProcTasks++;
+
+    // The task finishes after it has received the processing time of a whole
+    // core, counted from the current virtual time.
+    advance(time);
+    saved->m_Position = pushJob(SharingJob{
+        m_VirtualTime + procTime, task, event->getRouteDescriptor()});
+
+    // The share of each task has changed, therefore, the departure that has
+    // been scheduled becomes stale and a new one is scheduled.
+    m_Epoch++;
+    scheduleDeparture(time);
+}
+
+void SharingMachine::onTaskArrivalReverse(const timestamp_t time,
+                                          const Event      *event)
+{
+    const auto *saved =
+        ispd::reverse_data<SharingMachineArrivalReverseData>();
+
+    m_Metrics.m_LastActivityTime = saved->m_LastActivityTime;
+
+    // It checks if the packet has been forwarded by the machine. If so, only
+    // the forwarded packets counter has to be reversed.
+    if (event->getRouteDescriptor().getDestination() != getId()) {
+        m_Metrics.m_ForwardedPackets--;
+        return;
+    }
+
+    m_Metrics.m_ProcMFlops = saved->m_ProcMFlops;
+    m_Metrics.m_ProcTime   = saved->m_ProcTime;
+    m_Metrics.m_ProcTasks--;
+
+    pushJobReverse(saved->m_Position);
+    m_VirtualTime = saved->m_VirtualTime;
+    m_UpdateTime  = saved->m_UpdateTime;
+    m_Epoch--;
+}
+
+void SharingMachine::onTaskDeparture(const timestamp_t    time,
+                                     const TaskDeparture *departure)
+{
+    auto *saved = ispd::reverse_data<SharingMachineDepartureReverseData>();
+
+    // It checks if a task has arrived or departed since the departure has
+    // been scheduled. If so, the departure is stale and it is ignored.
+    if (departure->m_Epoch != m_Epoch) {
+        saved->m_Position = StaleDeparture;
+        return;
+    }
+
+    const SharingJob job = m_Jobs[0];
+    saved->m_Job         = job;
+    saved->m_Position    = popJob();
+
+    // The virtual time has reached the task's finish tag, which is set as is,
+    // such that, the rounding errors do not accumulate.
+    m_VirtualTime = job.m_FinishTag;
+    m_UpdateTime  = time;
+    m_Epoch++;
+
+    const Task            &task            = job.m_Task;
+    const RouteDescriptor &routeDescriptor = job.m_RouteDescriptor;
+
+    // The processed task travels the route back to its source, as it does in
+    // the `Machine`. Its route is carried inline again if it is short enough.
+    const std::size_t offset =
+        g_ForwardingTable ? 0ULL : routeDescriptor.getOffset() - 2ULL;
+
+    SourceRoutedEvent e(Task(task.getTid(),
+                             task.getOrigin(),
+                             task.getProcessingSize(),
+                             task.getCommunicationSize(),
+                             TaskCompletionState::PROCESSED),
+                        RouteDescriptor(routeDescriptor.getSource(),
+                                        routeDescriptor.getDestination(),
+                                        getId(),
+                                        offset,
+                                        false));
+
+    const sid_t next = g_ForwardingTable ? e.getNextHop(getId())
+                                         : routeDescriptor.getPreviousService();
+
+    ispd::schedule_event(next, time, TASK_ARRIVAL, &e, e.getSize());
+
+    scheduleDeparture(time);
+}
+
+void SharingMachine::onTaskDepartureReverse(const timestamp_t    time,
+                                            const TaskDeparture *departure)
+{
+    const auto *saved =
+        ispd::reverse_data<SharingMachineDepartureReverseData>();
+
+    if (saved->m_Position == StaleDeparture)
+        return;
+
+    popJobReverse(saved->m_Job, saved->m_Position);
+    m_VirtualTime = departure->m_VirtualTime;
+    m_UpdateTime  = departure->m_UpdateTime;
+    m_Epoch--;
+}
+
+void SharingMachine::scheduleDeparture(const timestamp_t time)
+{
+    if (m_JobCount == 0U)
+        return;
+
+    const TaskDeparture departure{m_Epoch, m_UpdateTime, m_VirtualTime};
+
+    // The virtual time advances at the share of each task, therefore, the
+    // task with the least finish tag departs after the remaining virtual
+    // time divided by that share.
+    const timestamp_t departureTime =
+        time + std::max(0.0, m_Jobs[0].m_FinishTag - m_VirtualTime) /
+                   getShare(m_JobCount);
+
+    ispd::schedule_event(getId(),
+                         departureTime,
+                         TASK_DEPARTURE,
+                         &departure,
+                         sizeof(departure));
+}
+
+uint32_t SharingMachine::pushJob(const SharingJob &job)
+{
+    // It checks if the heap is full. If so, its capacity is doubled.
+    if (m_JobCount == m_JobCapacity) {
+        const uint32_t capacity = std::max(4U, 2U * m_JobCapacity);
+        SharingJob    *jobs =
+            ROOTSimAllocator<>::allocate<SharingJob>(capacity);
+
+        if (m_Jobs) {
+            std::memcpy(jobs, m_Jobs, sizeof(SharingJob) * m_JobCount);
+            ROOTSimAllocator<>::deallocate(m_Jobs);
+        }
+
+        m_Jobs        = jobs;
+        m_JobCapacity = capacity;
+    }
+
+    // The task is sifted up from the last position, moving each parent with
+    // a greater finish tag down by one level.
+    uint32_t position = m_JobCount++;
+
+    while (position > 0U) {
+        const uint32_t parent = (position - 1U) / 2U;
+
+        if (!(job.m_FinishTag < m_Jobs[parent].m_FinishTag))
+            break;
+
+        m_Jobs[position] = m_Jobs[parent];
+        position         = parent;
+    }
+
+    m_Jobs[position] = job;
+    return position;
+}
+
+void SharingMachine::pushJobReverse(const uint32_t position)
+{
+    // The tasks that have been moved down lie on the path from the inserted
+    // task's position to the last position, which are moved back up, from
+    // the top to the bottom of the path. The path is obtained from the
+    // ancestors of the last position, using one-based positions.
+    const uint32_t last   = m_JobCount;
+    uint32_t       levels = 0U;
+
+    while ((last >> levels) > position + 1U)
+        levels++;
+
+    uint32_t hole = position;
+
+    while (levels-- > 0U) {
+        const uint32_t child = (last >> levels) - 1U;
+        m_Jobs[hole]         = m_Jobs[child];
+        hole                 = child;
+    }
+
+    m_JobCount--;
+}
+
+uint32_t SharingMachine::popJob()
+{
+    const SharingJob last = m_Jobs[--m_JobCount];
+
+    if (m_JobCount == 0U)
+        return 0U;
+
+    // The last task is sifted down from the root, moving each child with the
+    // least finish tag up by one level.
+    uint32_t position = 0U;
+
+    for (;;) {
+        uint32_t child = 2U * position + 1U;
+
+        if (child >= m_JobCount)
+            break;
+
+        if (child + 1U < m_JobCount &&
+            m_Jobs[child + 1U].m_FinishTag < m_Jobs[child].m_FinishTag)
+            child++;
+
+        if (!(m_Jobs[child].m_FinishTag < last.m_FinishTag))
+            break;
+
+        m_Jobs[position] = m_Jobs[child];
+        position         = child;
+    }
+
+    m_Jobs[position] = last;
+    return position;
+}
+
+void SharingMachine::popJobReverse(const SharingJob &job,
+                                   const uint32_t    position)
+{
+    // It checks if the heap has become empty. If so, the last task has not
+    // been put anywhere, and the removed task is the only one.
+    if (m_JobCount == 0U) {
+        m_Jobs[m_JobCount++] = job;
+        return;
+    }
+
+    // The tasks that have been moved up lie on the path from the root to the
+    // position in which the last task has been put, which are moved back
+    // down, from the bottom to the top of the path.
+    const SharingJob last = m_Jobs[position];
+
+    for (uint32_t hole = position; hole > 0U; hole = (hole - 1U) / 2U)
+        m_Jobs[hole] = m_Jobs[(hole - 1U) / 2U];
+
+    m_Jobs[0]            = job;
+    m_Jobs[m_JobCount++] = last;
+}
@@ -1,9 +1,15 @@
 #include <algorithm>
 #include <core/core.hpp>
-#include <routing/table.hpp>
 #include <service/switch.hpp>
 
-extern RoutingTable *g_RoutingTable;
+/// \brief The switch's values overwritten by the task arrival handler.
+struct SwitchReverseData
+{
+    timestamp_t m_AvailableTime;
+    timestamp_t m_LastActivityTime;
+    double      m_CommMBits;
+    double      m_CommTime;
+};
 
 ENGINE_INLINE
 static void doSwitchPacketForwarding(const sid_t       switchId,
@@ -18,16 +24,23 @@ static void doSwitchPacketForwarding(const sid_t       switchId,
     const auto forwardDirection = routeDescriptor.getForwardingDirection();
     const auto newOffset = forwardDirection ? offset + 1ULL : offset - 1ULL;
 
-    // It fetches the routing from the routing table using the source
-    // and destination identifier.
-    const Route *route = g_RoutingTable->getRoute(source, destination);
+    // It fetches the next service in the route, which is obtained from the
+    // forwarding table if it is set. Otherwise, it is read from the event
+    // itself if the route is carried inline, or it is fetched from the route
+    // provider using the source and destination identifier.
+    const uint32_t next = g_ForwardingTable
+                              ? event->getNextHop(switchId)
+                              : event->getHop(offset);
 
-    // Prepare the event to be send to the next service.
-    Event e(event->getTask(),
-            RouteDescriptor(
-                source, destination, switchId, newOffset, forwardDirection));
+    // Prepare the event to be send to the next service, which carries the
+    // route inline if the received event does.
+    SourceRoutedEvent e(
+        event->getTask(),
+        RouteDescriptor(
+            source, destination, switchId, newOffset, forwardDirection),
+        *event);
 
-    ispd::schedule_event((*route)[offset], now, TASK_ARRIVAL, &e, sizeof(e));
+    ispd::schedule_event(next, now, TASK_ARRIVAL, &e, e.getSize());
 }
 
 void Switch::onTaskArrival(timestamp_t now, const Event *event)
@@ -39,6 +52,13 @@ void Switch::onTaskArrival(timestamp_t now, const Event *event)
     const double commSize = task.getCommunicationSize();
     const double commTime = timeToCommunicate(commSize);
 
+    /// Save the values to be restored if this event is reversed.
+    SwitchReverseData *saved  = ispd::reverse_data<SwitchReverseData>();
+    saved->m_AvailableTime    = m_AvailableTime;
+    saved->m_LastActivityTime = m_Metrics.m_LastActivityTime;
+    saved->m_CommMBits        = m_Metrics.m_CommMBits;
+    saved->m_CommTime         = m_Metrics.m_CommTime;
+
     /// Calculate the internal queueing model timings.
     const timestamp_t waitingTime   = std::max(0.0, m_AvailableTime - now);
     const timestamp_t departureTime = now + waitingTime + commTime;
@@ -54,3 +74,14 @@ void Switch::onTaskArrival(timestamp_t now, const Event *event)
     /// Forward the packet.
     doSwitchPacketForwarding(getId(), now, event);
 }
+
+void Switch::onTaskArrivalReverse(timestamp_t now, const Event *event)
+{
+    const SwitchReverseData *saved = ispd::reverse_data<SwitchReverseData>();
+
+    m_AvailableTime              = saved->m_AvailableTime;
+    m_Metrics.m_LastActivityTime = saved->m_LastActivityTime;
+    m_Metrics.m_CommMBits        = saved->m_CommMBits;
+    m_Metrics.m_CommTime         = saved->m_CommTime;
+    m_Metrics.m_CommPackets--;
+}
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <service/link.hpp>
+#include <simulator/conservative.hpp>
+#include <thread>
+
+/// \brief Returns the representative of the service's group, halving the
+///        path to it.
+static sid_t findGroup(std::vector<sid_t> &groups, sid_t id)
+{
+    while (groups[id] != id) {
+        groups[id] = groups[groups[id]];
+        id         = groups[id];
+    }
+
+    return id;
+}
+
+/// \brief Assigns the services without lookahead that may schedule events to
+///        each other within a window to the same kernel.
+///
+/// The services only communicate through the links. Therefore, a link without
+/// lookahead is grouped with its ends without lookahead, and every service of
+/// a group is owned by the kernel that owns the group's least identifier.
+static void colocateServices(std::vector<ispd::sim::NativeLogicalProcess> &lps)
+{
+    std::vector<sid_t> groups(lps.size());
+    std::iota(groups.begin(), groups.end(), 0ULL);
+
+    for (sid_t id = 0; id < lps.size(); id++) {
+        const Service *service = lps[id].m_State;
+
+        if (lps[id].m_Phase != 0 || service->getKind() != ServiceKind::LINK)
+            continue;
+
+        const Link *link = static_cast<const Link *>(service);
+
+        for (const sid_t end : {link->getFrom(), link->getTo()}) {
+            if (end >= lps.size() || lps[end].m_Phase != 0)
+                continue;
+
+            // The group with the greater representative is merged into the
+            // other, such that, every representative is its group's least
+            // identifier.
+            const sid_t a = findGroup(groups, id);
+            const sid_t b = findGroup(groups, end);
+            groups[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    // The representatives are visited before the other services of their
+    // groups, therefore, their owners are never changed before being read.
+    for (sid_t id = 0; id < lps.size(); id++)
+        lps[id].m_Owner = lps[findGroup(groups, id)].m_Owner;
+}
+
+void ispd::sim::ConservativeSimulator::simulate()
+{
+    std::vector<NativeLogicalProcess> states(m_Services.size());
+    const uint32_t threads = partitionServices(states, m_Threads);
+
+    // The last kernel is not owned by any thread and it is only used while
+    // the services are initialized. Therefore, every event scheduled by the
+    // initializers is buffered and delivered after the services' phases and
+    // owners are known.
+    std::unique_ptr<NativeKernel> initializer(
+        new NativeKernel(threads, threads + 1, states));
+
+    ispd::native::g_Active = true;
+
+    initializeServices(*this, states, *initializer, m_Seed);
+
+    timestamp_t lookahead = std::numeric_limits<timestamp_t>::infinity();
+
+    for (NativeLogicalProcess &state : states) {
+        const timestamp_t serviceLookahead = state.m_State->getLookahead();
+
+        if (serviceLookahead > 0.0) {
+            state.m_Phase = 1;
+            lookahead     = std::min(lookahead, serviceLookahead);
+        }
+        else
+            state.m_Phase = 0;
+    }
+
+    // It checks if no service has a positive lookahead. If so, the windows
+    // would be empty and, therefore, the program is immediately aborted.
+    if (UNLIKELY(lookahead == std::numeric_limits<timestamp_t>::infinity()))
+        die("The conservative simulation requires at least one service with "
+            "a positive lookahead.");
+
+    colocateServices(states);
+
+    std::vector<std::unique_ptr<NativeKernel>> kernels;
+
+    for (uint32_t i = 0; i < threads; i++)
+        kernels.emplace_back(new NativeKernel(i, threads + 1, states));
+
+    initializer->redirect();
+    kernels.push_back(std::move(initializer));
+
+    NativeBarrier barrier(threads);
+
+    const auto worker = [&](const uint32_t id) {
+        NativeKernel &kernel = *kernels[id];
+
+        setCurrentContext(&kernel);
+        kernel.deliver(kernels);
+
+        for (;;) {
+            // The window starts at the least pending timestamp. When there
+            // are no more pending events, the simulation has finished.
+            const timestamp_t start = barrier.wait(kernel.getNextTime());
+
+            if (start == std::numeric_limits<timestamp_t>::infinity())
+                break;
+
+            const timestamp_t end = start + lookahead;
+
+            kernel.process(0, end);
+            barrier.wait(0.0);
+            kernel.deliver(kernels);
+            barrier.wait(0.0);
+
+            kernel.process(1, end);
+
+            // Every event before the end of the window has been processed,
+            // therefore, the services' states are final. If every service is
+            // quiescent, the simulation has finished, even though there may
+            // be pending events.
+            if (barrier.wait(kernel.isQuiescent() ? 1.0 : 0.0) != 0.0)
+                break;
+
+            kernel.deliver(kernels);
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (uint32_t id = 1; id < threads; id++)
+        workers.emplace_back(worker, id);
+
+    worker(0);
+
+    for (std::thread &thread : workers)
+        thread.join();
+
+    finalizeServices(*this, states);
+
+    setCurrentContext(nullptr);
+    ispd::native::g_Active = false;
+}
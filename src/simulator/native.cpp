@@ -0,0 +1,396 @@
+#include <algorithm>
+#include <cstring>
+#include <engine.hpp>
+#include <limits>
+#include <service/dispatch.hpp>
+#include <service/master.hpp>
+#include <service/sharing_machine.hpp>
+#include <simulator/native.hpp>
+#include <thread>
+
+/// \brief The context that serves the engine API in the current thread.
+static thread_local ispd::sim::NativeContext *g_Context;
+
+/// \brief The reverse data scratch storage used while no native engine is
+///        progressing the simulation.
+alignas(std::max_align_t) static thread_local unsigned char
+    g_ReverseData[ENGINE_MAX_REVERSE_DATA_SIZE];
+
+bool ispd::native::g_Active = false;
+
+void ispd::native::schedule_event(const sid_t       id,
+                                  const timestamp_t time,
+                                  const unsigned    eventType,
+                                  const void       *event,
+                                  const std::size_t eventSize)
+{
+    g_Context->schedule(id, time, eventType, event, eventSize);
+}
+
+void ispd::native::schedule_events(const ScheduledEvent *events,
+                                   const std::size_t     count)
+{
+    g_Context->scheduleBatch(events, count);
+}
+
+double ispd::native::random()
+{
+    return g_Context->random();
+}
+
+void *ispd::native::reverse_data()
+{
+    return g_Context ? g_Context->getReverseData() : g_ReverseData;
+}
+
+void ispd::sim::NativeKernel::scheduleBatch(
+    const ispd::ScheduledEvent *events, const std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+        post(events[i].m_Receiver,
+             events[i].m_Time,
+             events[i].m_Type,
+             events[i].m_Content,
+             events[i].m_Size,
+             true);
+}
+
+void ispd::sim::NativeKernel::post(const sid_t       id,
+                                   const timestamp_t time,
+                                   const unsigned    eventType,
+                                   const void       *event,
+                                   const std::size_t eventSize,
+                                   const bool        bulk)
+{
+    // It checks if the event is being scheduled to a service that does not
+    // exist. If so, the program is immediately aborted.
+    if (UNLIKELY(id >= m_Lps.size()))
+        die("Scheduling an event to the service %llu, but there are only %zu "
+            "services.",
+            id,
+            m_Lps.size());
+
+    // It checks if the event is being scheduled in the past. If so, the
+    // causality would be violated and, therefore, the program is immediately
+    // aborted.
+    if (UNLIKELY(time < m_Now))
+        die("Service %llu is scheduling an event at %lf, which is before the "
+            "current time %lf.",
+            m_Current,
+            time,
+            m_Now);
+
+    // It checks if the event content does not fit in the event slot. If so,
+    // the program is immediately aborted.
+    if (UNLIKELY(eventSize > NATIVE_MAX_EVENT_SIZE))
+        die("Event size (%zu) is greater than the maximum event size (%d).",
+            eventSize,
+            NATIVE_MAX_EVENT_SIZE);
+
+    const NativeLogicalProcess &receiver = m_Lps[id];
+    checkWindow(id, time, receiver);
+
+    // The ordering key is given by the sender, such that, the events with the
+    // same timestamp are ordered equally regardless of their receiver's
+    // kernel.
+    PendingEvent key;
+    key.m_Time     = toEventTime(time);
+    key.m_Sequence = m_Lps[m_Current].m_Sequence++;
+    key.m_Source   = static_cast<uint32_t>(m_Current);
+
+    NativeEventSlot *slot;
+
+    // It checks if the receiver is owned by another kernel. If so, the
+    // event is buffered in the receiver's kernel outbox.
+    if (receiver.m_Owner != m_Id) {
+        std::vector<NativeRemoteEvent> &outbox = m_Outboxes[receiver.m_Owner];
+        outbox.emplace_back();
+
+        NativeRemoteEvent &remote = outbox.back();
+        remote.m_Time             = key.m_Time;
+        remote.m_Sequence         = key.m_Sequence;
+        remote.m_Source           = key.m_Source;
+        slot                      = &remote.m_Slot;
+    }
+    else {
+        key.m_Slot = m_Pool.acquire();
+        slot       = &m_Pool[key.m_Slot];
+    }
+
+    slot->m_Receiver = id;
+    slot->m_Type     = eventType;
+    slot->m_Size     = static_cast<unsigned>(eventSize);
+
+    if (eventSize)
+        std::memcpy(slot->m_Content, event, eventSize);
+
+    if (receiver.m_Owner == m_Id)
+        enqueue(key, bulk);
+}
+
+void ispd::sim::NativeKernel::checkWindow(
+    const sid_t                 id,
+    const timestamp_t           time,
+    const NativeLogicalProcess &receiver) const
+{
+    // Events with a timestamp beyond the current window are always safe,
+    // since they are processed only after the next synchronization.
+    if (LIKELY(time >= m_WindowEnd))
+        return;
+
+    // It checks if the event would be delivered to a service whose events
+    // in the current window have already been processed, or that is being
+    // concurrently processed by another kernel. If so, the lookahead has been
+    // violated and, therefore, the program is immediately aborted.
+    if (UNLIKELY(receiver.m_Phase < m_Phase ||
+                 (receiver.m_Phase == m_Phase && receiver.m_Owner != m_Id)))
+        die("Service %llu is scheduling an event to the service %llu at %lf, "
+            "which is before the end of the current window %lf. The service "
+            "%llu does not respect the lookahead.",
+            m_Current,
+            id,
+            time,
+            m_WindowEnd,
+            m_Current);
+}
+
+void ispd::sim::NativeKernel::enqueue(const PendingEvent &event,
+                                      const bool          bulk)
+{
+    const uint32_t phase = m_Lps[m_Pool[event.m_Slot].m_Receiver].m_Phase;
+
+    if (bulk)
+        m_PendingEvents[phase].pushBulk(event);
+    else
+        m_PendingEvents[phase].push(event);
+}
+
+double ispd::sim::NativeKernel::random()
+{
+    return drawRandom(m_Lps[m_Current].m_RandomState);
+}
+
+void ispd::sim::NativeKernel::dispatch(const timestamp_t      now,
+                                       const NativeEventSlot &slot)
+{
+    Service *service = m_Lps[slot.m_Receiver].m_State;
+
+    switch (slot.m_Type) {
+    case TASK_ARRIVAL: {
+        const Event *e = reinterpret_cast<const Event *>(slot.m_Content);
+
+        /* Calls the service's task arrival handler */
+        dispatchTaskArrival(service, now, e);
+        break;
+    }
+    case TASK_SCHEDULER_INIT: {
+        Master *master = static_cast<Master *>(service);
+
+        /// Calls the master's task scheduler init handler.
+        master->onSchedulerInit(now);
+        break;
+    }
+    case TASK_DEPARTURE: {
+        SharingMachine *machine = static_cast<SharingMachine *>(service);
+
+        /// Calls the processor-sharing machine's task departure handler.
+        machine->onTaskDeparture(
+            now, reinterpret_cast<const TaskDeparture *>(slot.m_Content));
+        break;
+    }
+    default:
+        die("Unknown event type (%u).", slot.m_Type);
+    }
+}
+
+void ispd::sim::NativeKernel::process(const uint32_t    phase,
+                                      const timestamp_t end)
+{
+    NativeEventSet &pendingEvents = m_PendingEvents[phase];
+    const EventTime limit         = toEventTime(end);
+
+    m_Phase     = phase;
+    m_WindowEnd = end;
+
+    // Process the events in non-decreasing timestamp order until there are
+    // no more pending events before the end.
+    while (!pendingEvents.empty() && pendingEvents.top().m_Time < limit) {
+        const PendingEvent     event = pendingEvents.pop();
+        const NativeEventSlot &slot  = m_Pool[event.m_Slot];
+
+        m_Now     = fromEventTime(event.m_Time);
+        m_Current = slot.m_Receiver;
+
+        dispatch(m_Now, slot);
+        m_Pool.release(event.m_Slot);
+        m_ProcessedEvents++;
+    }
+}
+
+void ispd::sim::NativeKernel::deliver(
+    std::vector<std::unique_ptr<NativeKernel>> &kernels)
+{
+    // The outboxes are delivered in the kernels' order. The ties ordering
+    // does not depend on it, since the events carry their senders' keys, but
+    // the pending event sets are then filled reproducibly.
+    for (const auto &kernel : kernels) {
+        std::vector<NativeRemoteEvent> &outbox = kernel->m_Outboxes[m_Id];
+
+        for (const NativeRemoteEvent &remote : outbox) {
+            const uint32_t   slotIndex = m_Pool.acquire();
+            NativeEventSlot &slot      = m_Pool[slotIndex];
+
+            slot.m_Receiver = remote.m_Slot.m_Receiver;
+            slot.m_Type     = remote.m_Slot.m_Type;
+            slot.m_Size     = remote.m_Slot.m_Size;
+            std::memcpy(slot.m_Content, remote.m_Slot.m_Content, slot.m_Size);
+
+            enqueue(PendingEvent{remote.m_Time,
+                                 remote.m_Sequence,
+                                 remote.m_Source,
+                                 slotIndex},
+                    true);
+        }
+
+        outbox.clear();
+    }
+}
+
+void ispd::sim::NativeKernel::redirect()
+{
+    std::vector<NativeRemoteEvent> buffered;
+
+    for (std::vector<NativeRemoteEvent> &outbox : m_Outboxes) {
+        buffered.insert(buffered.end(), outbox.begin(), outbox.end());
+        outbox.clear();
+    }
+
+    for (const NativeRemoteEvent &remote : buffered)
+        m_Outboxes[m_Lps[remote.m_Slot.m_Receiver].m_Owner].push_back(remote);
+}
+
+timestamp_t ispd::sim::NativeKernel::getNextTime()
+{
+    EventTime next = EventTimeInfinity;
+
+    for (NativeEventSet &pendingEvents : m_PendingEvents)
+        if (!pendingEvents.empty())
+            next = std::min(next, pendingEvents.top().m_Time);
+
+    return fromEventTime(next);
+}
+
+bool ispd::sim::NativeKernel::isQuiescent() const
+{
+    for (const sid_t id : m_Owned)
+        if (!m_Lps[id].m_State->isQuiescent())
+            return false;
+
+    return true;
+}
+
+timestamp_t ispd::sim::NativeBarrier::wait(const timestamp_t value)
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    if (m_Arrived == 0)
+        m_Min = value;
+    else
+        m_Min = std::min(m_Min, value);
+
+    // It checks if the calling thread is the last one to arrive. If so, the
+    // result is published and the waiting threads are released.
+    if (++m_Arrived == m_Threads) {
+        m_Arrived = 0;
+        m_Result  = m_Min;
+        m_Generation++;
+        m_Condition.notify_all();
+        return m_Result;
+    }
+
+    const uint64_t generation = m_Generation;
+    m_Condition.wait(lock, [&] { return generation != m_Generation; });
+    return m_Result;
+}
+
+void ispd::sim::setCurrentContext(NativeContext *context)
+{
+    g_Context = context;
+}
+
+uint32_t ispd::sim::partitionServices(std::vector<NativeLogicalProcess> &lps,
+                                      uint32_t threads)
+{
+    const sid_t count = lps.size();
+
+    if (threads == 0)
+        threads = std::max(1U, std::thread::hardware_concurrency());
+
+    // It checks if there are more threads than services. If so, the amount of
+    // threads is reduced, such that, every thread owns at least one service.
+    if (threads > count)
+        threads = static_cast<uint32_t>(std::max<sid_t>(1ULL, count));
+
+    for (sid_t id = 0; id < count; id++)
+        lps[id].m_Owner = static_cast<uint32_t>(id * threads / count);
+
+    return threads;
+}
+
+void ispd::sim::initializeServices(Simulator                         &simulator,
+                                   std::vector<NativeLogicalProcess> &lps,
+                                   NativeContext                     &context,
+                                   const uint64_t                     seed)
+{
+    const ServiceTable &services = simulator.getServiceTable();
+
+    // It checks if the services' identifiers do not fit in the pending events'
+    // keys. If so, the program is immediately aborted.
+    if (UNLIKELY(lps.size() > std::numeric_limits<uint32_t>::max()))
+        die("The native engine supports at most %u services, but %zu services "
+            "have been registered.",
+            std::numeric_limits<uint32_t>::max(),
+            lps.size());
+
+    setCurrentContext(&context);
+
+    // Initialize the services. The service initializers are called in the
+    // services' identifiers order and each service has its own random
+    // stream, such that, the results are reproducible.
+    for (sid_t id = 0; id < lps.size(); id++) {
+        context.setCurrent(id);
+        lps[id].m_RandomState = seed ^ (id * 0xD1B54A32D192ED03ULL);
+        lps[id].m_Sequence    = 0ULL;
+        lps[id].m_State       = services.initialize(id);
+    }
+}
+
+void ispd::sim::finalizeServices(
+    Simulator &simulator, const std::vector<NativeLogicalProcess> &lps)
+{
+    const ServiceTable &services = simulator.getServiceTable();
+
+    // Finalize the services. Unlikely the service initializer, there is no
+    // strict requirement for all services to have a service finalizer.
+    for (sid_t id = 0; id < lps.size(); id++)
+        services.finalize(id, lps[id].m_State);
+}
+
+void ispd::sim::NativeSimulator::simulate()
+{
+    std::vector<NativeLogicalProcess> lps(m_Services.size());
+    NativeKernel                      kernel(0, 1, lps);
+
+    ispd::native::g_Active = true;
+
+    initializeServices(*this, lps, kernel, m_Seed);
+
+    // Process the events in non-decreasing timestamp order until there are
+    // no more pending events.
+    kernel.process(0, std::numeric_limits<timestamp_t>::infinity());
+
+    finalizeServices(*this, lps);
+
+    setCurrentContext(nullptr);
+    ispd::native::g_Active = false;
+}
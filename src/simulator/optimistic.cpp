@@ -0,0 +1,525 @@
+#include <cstring>
+#include <limits>
+#include <service/dispatch.hpp>
+#include <service/master.hpp>
+#include <service/sharing_machine.hpp>
+#include <simulator/optimistic.hpp>
+#include <thread>
+
+ispd::sim::OptimisticKernel::OptimisticKernel(
+    const uint32_t                     id,
+    const uint32_t                     kernels,
+    std::vector<NativeLogicalProcess> &lps,
+    std::vector<OptimisticHistory>    &histories)
+    : m_Id(id), m_Lps(lps), m_Histories(histories), m_ReverseData(m_Scratch)
+{
+    m_Outboxes[0].resize(kernels);
+    m_Outboxes[1].resize(kernels);
+
+    for (sid_t sid = 0; sid < lps.size(); sid++)
+        if (lps[sid].m_Owner == id)
+            m_Owned.push_back(sid);
+}
+
+void ispd::sim::OptimisticKernel::schedule(const sid_t       id,
+                                           const timestamp_t time,
+                                           const unsigned    eventType,
+                                           const void       *event,
+                                           const std::size_t eventSize)
+{
+    // It checks if the event is being scheduled to a service that does not
+    // exist. If so, the program is immediately aborted.
+    if (UNLIKELY(id >= m_Lps.size()))
+        die("Scheduling an event to the service %llu, but there are only %zu "
+            "services.",
+            id,
+            m_Lps.size());
+
+    // It checks if the event is being scheduled in the past. If so, the
+    // causality would be violated and, therefore, the program is immediately
+    // aborted.
+    if (UNLIKELY(time < m_Now))
+        die("Service %llu is scheduling an event at %lf, which is before the "
+            "current time %lf.",
+            m_Current,
+            time,
+            m_Now);
+
+    // It checks if the event content does not fit in the event slot. If so,
+    // the program is immediately aborted.
+    if (UNLIKELY(eventSize > NATIVE_MAX_EVENT_SIZE))
+        die("Event size (%zu) is greater than the maximum event size (%d).",
+            eventSize,
+            NATIVE_MAX_EVENT_SIZE);
+
+    // The identifier is unique among all kernels, such that, the anti-event
+    // can be matched with the event by its receiver.
+    const uint64_t eventId = (static_cast<uint64_t>(m_Id) << 48) | m_NextId++;
+
+    // The ordering key is given by the sender. The sender's sequence is
+    // rewound if the event being processed is rolled back, such that, the
+    // events scheduled again receive the same keys.
+    PendingEvent key;
+    key.m_Time     = toEventTime(time);
+    key.m_Sequence = m_Lps[m_Current].m_Sequence++;
+    key.m_Source   = static_cast<uint32_t>(m_Current);
+
+    // It checks if the event is being scheduled by an uncommitted event. If
+    // so, it is recorded to be annihilated if the sender is rolled back.
+    if (m_Record) {
+        m_Record->m_SentEvents++;
+        m_Histories[m_Current].m_SentEvents.push_back(SentEvent{eventId, id});
+    }
+
+    const uint32_t owner = m_Lps[id].m_Owner;
+
+    // It checks if the receiver is owned by another kernel. If so, the
+    // event is buffered in the receiver's kernel outbox.
+    if (owner != m_Id) {
+        std::vector<OptimisticMessage> &outbox = m_Outboxes[m_Buffer][owner];
+        outbox.emplace_back();
+
+        OptimisticMessage &message = outbox.back();
+        message.m_Time             = key.m_Time;
+        message.m_Sequence         = key.m_Sequence;
+        message.m_Source           = key.m_Source;
+        message.m_Id               = eventId;
+        message.m_Anti             = false;
+        message.m_Slot.m_Receiver  = id;
+        message.m_Slot.m_Type      = eventType;
+        message.m_Slot.m_Size      = static_cast<unsigned>(eventSize);
+
+        if (eventSize)
+            std::memcpy(message.m_Slot.m_Content, event, eventSize);
+        return;
+    }
+
+    key.m_Slot            = m_Pool.acquire();
+    NativeEventSlot &slot = m_Pool[key.m_Slot];
+
+    slot.m_Receiver = id;
+    slot.m_Type     = eventType;
+    slot.m_Size     = static_cast<unsigned>(eventSize);
+
+    if (eventSize)
+        std::memcpy(slot.m_Content, event, eventSize);
+
+    enqueue(key, eventId);
+}
+
+double ispd::sim::OptimisticKernel::random()
+{
+    // The draws are counted, such that, the random stream is rewound if the
+    // event being processed is rolled back.
+    if (m_Record)
+        m_Record->m_RandomDraws++;
+
+    return drawRandom(m_Lps[m_Current].m_RandomState);
+}
+
+void ispd::sim::OptimisticKernel::enqueue(const PendingEvent &event,
+                                          const uint64_t      id)
+{
+    const uint32_t slot = event.m_Slot;
+
+    if (slot >= m_Slots.size())
+        m_Slots.resize(slot + 1);
+
+    m_Slots[slot] = SlotInfo{id, event, SlotState::PENDING};
+    m_Events.emplace(id, slot);
+
+    const sid_t receiver  = m_Pool[slot].m_Receiver;
+    const auto &processed = m_Histories[receiver].m_ProcessedEvents;
+
+    // The events that a service schedules to itself at the current time may
+    // be ordered before the event that is being processed, whose handler has
+    // not returned yet. They are never stragglers, but processed after the
+    // current event, as in the sequential mode.
+    const bool self = receiver == m_Current && m_Record;
+
+    // It checks if the event is a straggler, that is, its receiver has
+    // already processed an event that should have been processed after it.
+    // If so, the receiver is rolled back.
+    if (!self && !processed.empty() && event < processed.back().m_Event)
+        rollback(receiver, event, false);
+
+    m_PendingEvents.push(event);
+}
+
+void ispd::sim::OptimisticKernel::rollback(const sid_t         id,
+                                           const PendingEvent &until,
+                                           const bool          annihilate)
+{
+    OptimisticHistory &history = m_Histories[id];
+
+    // The rollback may happen while another event is being processed,
+    // therefore, its context is restored after the rollback.
+    ProcessedEvent *const record      = m_Record;
+    unsigned char *const  reverseData = m_ReverseData;
+    const timestamp_t     now         = m_Now;
+    const sid_t           current     = m_Current;
+
+    m_Record  = nullptr;
+    m_Current = id;
+
+    while (!history.m_ProcessedEvents.empty()) {
+        ProcessedEvent &processed = history.m_ProcessedEvents.back();
+
+        if (processed.m_Event < until)
+            break;
+
+        m_ReverseData = processed.m_ReverseData;
+        m_Now         = fromEventTime(processed.m_Event.m_Time);
+
+        dispatch(m_Now, m_Pool[processed.m_Event.m_Slot], true);
+        rewindRandom(m_Lps[id].m_RandomState, processed.m_RandomDraws);
+        m_Lps[id].m_Sequence -= processed.m_SentEvents;
+
+        // Annihilate the events scheduled by the reversed event. The events
+        // owned by this kernel are annihilated after the rollback, since they
+        // may roll back other services.
+        for (uint32_t i = 0; i < processed.m_SentEvents; i++) {
+            const SentEvent sent  = history.m_SentEvents.back();
+            const uint32_t  owner = m_Lps[sent.m_Receiver].m_Owner;
+            history.m_SentEvents.pop_back();
+
+            if (owner == m_Id) {
+                m_Cancellations.push_back(sent);
+                continue;
+            }
+
+            std::vector<OptimisticMessage> &outbox =
+                m_Outboxes[m_Buffer][owner];
+            outbox.emplace_back();
+
+            OptimisticMessage &message = outbox.back();
+            message.m_Id               = sent.m_Id;
+            message.m_Anti             = true;
+            message.m_Slot.m_Receiver  = sent.m_Receiver;
+        }
+
+        const PendingEvent event = processed.m_Event;
+        history.m_ProcessedEvents.pop_back();
+        m_RolledBackEvents++;
+
+        // It checks if the reversed event is the one being annihilated. If
+        // so, it is discarded. Otherwise, it is processed again later.
+        if (annihilate && event.m_Slot == until.m_Slot) {
+            m_Pool.release(event.m_Slot);
+            break;
+        }
+
+        m_Slots[event.m_Slot].m_State = SlotState::PENDING;
+        m_PendingEvents.push(event);
+    }
+
+    m_Record      = record;
+    m_ReverseData = reverseData;
+    m_Now         = now;
+    m_Current     = current;
+}
+
+void ispd::sim::OptimisticKernel::cancel(const SentEvent &sent)
+{
+    const auto it = m_Events.find(sent.m_Id);
+
+    // It checks if the event being annihilated has not been received. Since
+    // the messages between two kernels are delivered in order, an anti-event
+    // is never received before its event and, therefore, the program is
+    // immediately aborted.
+    if (UNLIKELY(it == m_Events.end()))
+        die("Service %llu has received an anti-event for an unknown event.",
+            sent.m_Receiver);
+
+    const uint32_t slot = it->second;
+    SlotInfo      &info = m_Slots[slot];
+    m_Events.erase(it);
+
+    // It checks if the event is still pending. If so, it is marked as
+    // cancelled and it is discarded when it reaches the top of the pending
+    // event set. Otherwise, its receiver is rolled back.
+    if (info.m_State == SlotState::PENDING) {
+        info.m_State = SlotState::CANCELLED;
+        return;
+    }
+
+    rollback(sent.m_Receiver, info.m_Event, true);
+}
+
+void ispd::sim::OptimisticKernel::drainCancellations()
+{
+    while (!m_Cancellations.empty()) {
+        const SentEvent sent = m_Cancellations.back();
+        m_Cancellations.pop_back();
+        cancel(sent);
+    }
+}
+
+void ispd::sim::OptimisticKernel::dispatch(const timestamp_t      now,
+                                           const NativeEventSlot &slot,
+                                           const bool             reverse)
+{
+    Service *service = m_Lps[slot.m_Receiver].m_State;
+
+    switch (slot.m_Type) {
+    case TASK_ARRIVAL: {
+        const Event *e = reinterpret_cast<const Event *>(slot.m_Content);
+
+        /* Calls the service's task arrival handler */
+        if (reverse)
+            dispatchTaskArrivalReverse(service, now, e);
+        else
+            dispatchTaskArrival(service, now, e);
+        break;
+    }
+    case TASK_SCHEDULER_INIT: {
+        Master *master = static_cast<Master *>(service);
+
+        /// Calls the master's task scheduler init handler.
+        if (reverse)
+            master->onSchedulerInitReverse(now);
+        else
+            master->onSchedulerInit(now);
+        break;
+    }
+    case TASK_DEPARTURE: {
+        SharingMachine      *machine = static_cast<SharingMachine *>(service);
+        const TaskDeparture *departure =
+            reinterpret_cast<const TaskDeparture *>(slot.m_Content);
+
+        /// Calls the processor-sharing machine's task departure handler.
+        if (reverse)
+            machine->onTaskDepartureReverse(now, departure);
+        else
+            machine->onTaskDeparture(now, departure);
+        break;
+    }
+    default:
+        die("Unknown event type (%u).", slot.m_Type);
+    }
+}
+
+void ispd::sim::OptimisticKernel::process(const uint32_t batch)
+{
+    uint32_t processed = 0;
+
+    while (processed < batch && !m_PendingEvents.empty()) {
+        const PendingEvent event = m_PendingEvents.pop();
+        SlotInfo          &info  = m_Slots[event.m_Slot];
+
+        // It checks if the event has been annihilated while pending. If so,
+        // it is simply discarded.
+        if (info.m_State == SlotState::CANCELLED) {
+            m_Pool.release(event.m_Slot);
+            continue;
+        }
+
+        const NativeEventSlot &slot    = m_Pool[event.m_Slot];
+        OptimisticHistory     &history = m_Histories[slot.m_Receiver];
+
+        history.m_ProcessedEvents.emplace_back();
+        ProcessedEvent &record = history.m_ProcessedEvents.back();
+        record.m_Event         = event;
+        record.m_RandomDraws   = 0;
+        record.m_SentEvents    = 0;
+        info.m_State           = SlotState::PROCESSED;
+
+        m_Record      = &record;
+        m_ReverseData = record.m_ReverseData;
+        m_Now         = fromEventTime(event.m_Time);
+        m_Current     = slot.m_Receiver;
+
+        dispatch(m_Now, slot, false);
+
+        m_Record      = nullptr;
+        m_ReverseData = m_Scratch;
+
+        // The events scheduled to this kernel's services may have rolled
+        // back other services, whose scheduled events must be annihilated.
+        drainCancellations();
+        processed++;
+    }
+}
+
+bool ispd::sim::OptimisticKernel::deliver(
+    std::vector<std::unique_ptr<OptimisticKernel>> &kernels)
+{
+    // The anti-events sent due to the rollbacks caused by this delivery are
+    // buffered in the other outboxes, which are delivered in the next round.
+    const uint32_t incoming = m_Buffer;
+    m_Buffer ^= 1;
+
+    for (const auto &kernel : kernels) {
+        std::vector<OptimisticMessage> &outbox =
+            kernel->m_Outboxes[incoming][m_Id];
+
+        for (const OptimisticMessage &message : outbox) {
+            if (message.m_Anti) {
+                cancel(SentEvent{message.m_Id, message.m_Slot.m_Receiver});
+                drainCancellations();
+                continue;
+            }
+
+            const uint32_t   slotIndex = m_Pool.acquire();
+            NativeEventSlot &slot      = m_Pool[slotIndex];
+
+            slot.m_Receiver = message.m_Slot.m_Receiver;
+            slot.m_Type     = message.m_Slot.m_Type;
+            slot.m_Size     = message.m_Slot.m_Size;
+            std::memcpy(slot.m_Content, message.m_Slot.m_Content, slot.m_Size);
+
+            enqueue(PendingEvent{message.m_Time,
+                                 message.m_Sequence,
+                                 message.m_Source,
+                                 slotIndex},
+                    message.m_Id);
+            drainCancellations();
+        }
+
+        outbox.clear();
+    }
+
+    for (const auto &outbox : m_Outboxes[m_Buffer])
+        if (!outbox.empty())
+            return true;
+    return false;
+}
+
+timestamp_t ispd::sim::OptimisticKernel::getNextTime()
+{
+    // Discard the annihilated events at the top of the pending event set,
+    // since they must not hold back the global virtual time.
+    while (!m_PendingEvents.empty()) {
+        const PendingEvent &event = m_PendingEvents.top();
+
+        if (m_Slots[event.m_Slot].m_State != SlotState::CANCELLED)
+            return fromEventTime(event.m_Time);
+
+        m_Pool.release(m_PendingEvents.pop().m_Slot);
+    }
+
+    return std::numeric_limits<timestamp_t>::infinity();
+}
+
+void ispd::sim::OptimisticKernel::commit(const timestamp_t gvt)
+{
+    const EventTime limit = toEventTime(gvt);
+
+    for (const sid_t id : m_Owned) {
+        OptimisticHistory &history = m_Histories[id];
+
+        while (!history.m_ProcessedEvents.empty()) {
+            const ProcessedEvent &processed =
+                history.m_ProcessedEvents.front();
+
+            // The events at the global virtual time may still be rolled back
+            // by an anti-event, therefore, only the earlier ones are
+            // committed.
+            if (processed.m_Event.m_Time >= limit)
+                break;
+
+            const uint32_t slot = processed.m_Event.m_Slot;
+
+            m_Events.erase(m_Slots[slot].m_Id);
+            m_Pool.release(slot);
+
+            for (uint32_t i = 0; i < processed.m_SentEvents; i++)
+                history.m_SentEvents.pop_front();
+
+            history.m_ProcessedEvents.pop_front();
+            m_CommittedEvents++;
+        }
+    }
+}
+
+bool ispd::sim::OptimisticKernel::isQuiescent() const
+{
+    for (const sid_t id : m_Owned)
+        if (!m_Histories[id].m_ProcessedEvents.empty() ||
+            !m_Lps[id].m_State->isQuiescent())
+            return false;
+
+    return true;
+}
+
+void ispd::sim::OptimisticSimulator::simulate()
+{
+    const sid_t lps = m_Services.size();
+
+    std::vector<NativeLogicalProcess> states(lps);
+    std::vector<OptimisticHistory>    histories(lps);
+    const uint32_t threads = partitionServices(states, m_Threads);
+
+    // The last kernel is not owned by any thread and it is only used while
+    // the services are initialized. The initialization is never rolled back.
+    std::vector<std::unique_ptr<OptimisticKernel>> kernels;
+
+    for (uint32_t i = 0; i <= threads; i++)
+        kernels.emplace_back(
+            new OptimisticKernel(i, threads + 1, states, histories));
+
+    ispd::native::g_Active = true;
+
+    initializeServices(*this, states, *kernels[threads], m_Seed);
+
+    // It checks if there is a service that cannot be rolled back. If so,
+    // the program is immediately aborted.
+    for (const NativeLogicalProcess &state : states)
+        if (UNLIKELY(!state.m_State->isReversible()))
+            die("Service with id %llu does not support reverse computation, "
+                "which is required by the native optimistic simulation.",
+                state.m_State->getId());
+
+    NativeBarrier barrier(threads);
+
+    const auto worker = [&](const uint32_t id) {
+        OptimisticKernel &kernel = *kernels[id];
+
+        setCurrentContext(&kernel);
+        kernel.deliver(kernels);
+
+        for (;;) {
+            kernel.process(m_Batch);
+            barrier.wait(0.0);
+
+            // Deliver the messages until there is no message in transit,
+            // since the rollbacks caused by a delivery may send anti-events.
+            for (;;) {
+                const bool sent = kernel.deliver(kernels);
+
+                if (barrier.wait(sent ? 0.0 : 1.0) != 0.0)
+                    break;
+            }
+
+            // With no message in transit, the global virtual time is the
+            // least timestamp among the pending events. When there are no
+            // more pending events, the simulation has finished.
+            const timestamp_t gvt = barrier.wait(kernel.getNextTime());
+            kernel.commit(gvt);
+
+            if (gvt == std::numeric_limits<timestamp_t>::infinity())
+                break;
+
+            // It checks if every service is quiescent in its committed state.
+            // If so, the simulation has finished, even though there may be
+            // pending events.
+            if (barrier.wait(kernel.isQuiescent() ? 1.0 : 0.0) != 0.0)
+                break;
+        }
+    };
+
+    std::vector<std::thread> workers;
+
+    for (uint32_t id = 1; id < threads; id++)
+        workers.emplace_back(worker, id);
+
+    worker(0);
+
+    for (std::thread &thread : workers)
+        thread.join();
+
+    finalizeServices(*this, states);
+
+    setCurrentContext(nullptr);
+    ispd::native::g_Active = false;
+}
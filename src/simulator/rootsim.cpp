@@ -1,71 +1,97 @@
+#include <cstring>
 #include <engine.hpp>
 #include <iostream>
 #include <mutex>
+#include <routing/forwarding.hpp>
 #include <routing/table.hpp>
+#include <service/dispatch.hpp>
 #include <service/machine.hpp>
 #include <service/master.hpp>
+#include <service/sharing_machine.hpp>
+#include <simulator/native.hpp>
 #include <simulator/rootsim.hpp>
 
 static ispd::sim::ROOTSimSimulator *g_Simulator;
 
+/// \brief The timestamp and the size of the event being currently processed
+///        by the ROOT-Sim in this thread.
+static thread_local simtime_t g_CurrentTime;
+static thread_local unsigned  g_CurrentSize;
+
 /**
- * @brief The global routing table that is used by all
+ * @brief The global route provider that is used by all
  *        services that are located in this physical process.
  *
  * @details
  *        Further, this global variable will be moved to a more
  *        general location.
  */
-ENGINE_TEMPORARY RoutingTable *g_RoutingTable;
+ENGINE_TEMPORARY RouteProvider *g_RouteProvider;
+
+/**
+ * @brief The global forwarding table that is used by all
+ *        services that are located in this physical process.
+ *
+ * @details
+ *        If it is not set, then the services forward the
+ *        packets through the global route provider.
+ */
+ENGINE_TEMPORARY ForwardingTable *g_ForwardingTable;
+
+void ispd::rootsim::schedule_event(const sid_t       id,
+                                   const timestamp_t time,
+                                   const unsigned    eventType,
+                                   const void       *event,
+                                   const std::size_t eventSize)
+{
+    if (time != g_CurrentTime || eventSize >= g_CurrentSize) {
+        ScheduleNewEvent(id, time, eventType, event, eventSize);
+        return;
+    }
+
+    if (UNLIKELY(g_CurrentSize > NATIVE_MAX_EVENT_SIZE))
+        die("Event size (%u) is greater than the maximum event size (%d).",
+            g_CurrentSize,
+            NATIVE_MAX_EVENT_SIZE);
+
+    // The padding is never read by the event handlers. It is only sent so
+    // that the event is not ordered before the current event.
+    alignas(std::max_align_t) unsigned char padded[NATIVE_MAX_EVENT_SIZE];
+
+    std::memcpy(padded, event, eventSize);
+    std::memset(padded + eventSize, 0, g_CurrentSize - eventSize);
+    ScheduleNewEvent(id, time, eventType, padded, g_CurrentSize);
+}
 
 void ispd::sim::ROOTSimSimulator::simulate()
 {
     g_Simulator = this;
 
     /* Update the ROOT-Sim's simulation configuration */
-    m_Conf.lps        = m_ServiceInitializers.size();
-    m_Conf.committed  = [](lp_id_t me, const void *snapshot) { return false; };
+    m_Conf.lps        = m_Services.size();
+    m_Conf.committed  = [](lp_id_t me, const void *snapshot) {
+        // The simulation is halted as soon as every service is quiescent in
+        // its committed state. That is, there is no master with remaining
+        // workload or with dispatched tasks that have not been completed.
+        const Service *service = static_cast<const Service *>(snapshot);
+        return service->isQuiescent();
+    };
     m_Conf.dispatcher = [](lp_id_t     me,
                            simtime_t   now,
                            unsigned    event_type,
                            const void *content,
                            unsigned    size,
                            void       *s) {
+        g_CurrentTime = now;
+        g_CurrentSize = size;
+
         switch (event_type) {
         case LP_FINI: {
-            // It checks if no service finalizer has been registered for the
-            // current service. Unlikely the service initializer, there is no
-            // strict requirement for all services to have a service finalizer.
-            if (UNLIKELY(g_Simulator->getServicesFinalizers().find(me) ==
-                         g_Simulator->getServicesFinalizers().end()))
-                return;
-
-            const std::function<void(Service *)> &serviceFinalizer =
-                g_Simulator->getServicesFinalizers().at(me);
-            serviceFinalizer((Service *)s);
+            g_Simulator->getServiceTable().finalize(me, (Service *)s);
             break;
         }
         case LP_INIT: {
-            // It checks if no service has been registered with that id.
-            if (UNLIKELY(g_Simulator->getServices().find(me) ==
-                         g_Simulator->getServices().end()))
-                die("Service with id %llu has not been found.", me);
-
-            const std::function<Service *()> &serviceInitializer =
-                g_Simulator->getServices().at(me);
-
-            Service *service = serviceInitializer();
-
-            // It checks if the service with the specified identifier has been
-            // generated by a service initializer with another identifier. If
-            // so, the program will be immediately aborted.
-            if (UNLIKELY(service->getId() != me))
-                die("Service with id %llu has been generated by the service "
-                    "initializer with id %llu.\n",
-                    service->getId(),
-                    me);
-
-            SetState(service);
+            SetState(g_Simulator->getServiceTable().initialize(me));
             break;
         }
         case TASK_ARRIVAL: {
@@ -74,7 +100,7 @@ void ispd::sim::ROOTSimSimulator::simulate()
             Event   *e       = (Event *)content;
 
             /* Calls the service's task arrival handler */
-            service->onTaskArrival(now, e);
+            dispatchTaskArrival(service, now, e);
             break;
         }
         case TASK_SCHEDULER_INIT: {
@@ -84,6 +110,13 @@ void ispd::sim::ROOTSimSimulator::simulate()
             master->onSchedulerInit(now);
             break;
         }
+        case TASK_DEPARTURE: {
+            SharingMachine *machine = static_cast<SharingMachine *>(s);
+
+            /// Calls the processor-sharing machine's task departure handler.
+            machine->onTaskDeparture(now, (const TaskDeparture *)content);
+            break;
+        }
         default:
             fprintf(stderr, "Unknown event type\n");
             abort();
@@ -0,0 +1,248 @@
+#include <allocator/rootsim_allocator.hpp>
+#include <service/cluster.hpp>
+#include <service/dummy.hpp>
+#include <service/link.hpp>
+#include <service/machine.hpp>
+#include <service/sharing_machine.hpp>
+#include <service/switch.hpp>
+#include <simulator/service_table.hpp>
+
+void ispd::sim::ServiceTable::insert(const sid_t       serviceId,
+                                     const Initializer kind,
+                                     const std::size_t index)
+{
+    // It checks if the service's identifier does not fit in the events, in
+    // which the identifiers are stored in 32 bits. If so, the program is
+    // immediately aborted.
+    if (UNLIKELY(serviceId >= UINT32_MAX))
+        die("Service with id %llu does not fit in 32 bits.", serviceId);
+
+    // It checks if the parameters' index does not fit in the entry. If so,
+    // the program is immediately aborted.
+    if (UNLIKELY(index >= UINT32_MAX))
+        die("At most %u services of the same kind can be registered.",
+            UINT32_MAX);
+
+    if (serviceId >= m_Entries.size())
+        m_Entries.resize(serviceId + 1, Entry{0U, Initializer::NONE});
+
+    // It checks if a service with that id has already been registered. If
+    // so, then the program is immediately aborted.
+    if (UNLIKELY(m_Entries[serviceId].m_Kind != Initializer::NONE))
+        die("A service with id %lu has already been registered.", serviceId);
+
+    m_Entries[serviceId] = Entry{static_cast<uint32_t>(index), kind};
+}
+
+void ispd::sim::ServiceTable::registerService(
+    const sid_t serviceId, const std::function<Service *()> &serviceInitializer)
+{
+    insert(serviceId, Initializer::GENERIC, m_Generic.size());
+    m_Generic.push_back(serviceInitializer);
+}
+
+void ispd::sim::ServiceTable::registerMachine(const sid_t         machineId,
+                                              const double        power,
+                                              const double        loadFactor,
+                                              const int           cores,
+                                              const CoreSelection selection)
+{
+    insert(machineId, Initializer::MACHINE, m_Machines.m_Power.size());
+    m_Machines.m_Power.push_back(power);
+    m_Machines.m_LoadFactor.push_back(loadFactor);
+    m_Machines.m_Cores.push_back(cores);
+    m_Machines.m_CoreSelection.push_back(selection);
+}
+
+void ispd::sim::ServiceTable::registerSharingMachine(const sid_t  machineId,
+                                                     const double power,
+                                                     const double loadFactor,
+                                                     const int    cores)
+{
+    insert(machineId, Initializer::SHARING_MACHINE, m_Machines.m_Power.size());
+    m_Machines.m_Power.push_back(power);
+    m_Machines.m_LoadFactor.push_back(loadFactor);
+    m_Machines.m_Cores.push_back(cores);
+    m_Machines.m_CoreSelection.push_back(CoreSelection::AUTOMATIC);
+}
+
+void ispd::sim::ServiceTable::registerLink(const sid_t      linkId,
+                                           const sid_t      from,
+                                           const sid_t      to,
+                                           const double     bandwidth,
+                                           const double     loadFactor,
+                                           const double     latency,
+                                           const LinkDuplex duplex)
+{
+    insert(linkId, Initializer::LINK, m_Links.m_From.size());
+    m_Links.m_From.push_back(from);
+    m_Links.m_To.push_back(to);
+    m_Links.m_Bandwidth.push_back(bandwidth);
+    m_Links.m_LoadFactor.push_back(loadFactor);
+    m_Links.m_Latency.push_back(latency);
+    m_Links.m_Duplex.push_back(duplex);
+}
+
+void ispd::sim::ServiceTable::registerSwitch(const sid_t  switchId,
+                                             const double bandwidth,
+                                             const double loadFactor,
+                                             const double latency)
+{
+    insert(switchId, Initializer::SWITCH, m_Switches.m_Bandwidth.size());
+    m_Switches.m_Bandwidth.push_back(bandwidth);
+    m_Switches.m_LoadFactor.push_back(loadFactor);
+    m_Switches.m_Latency.push_back(latency);
+}
+
+void ispd::sim::ServiceTable::registerCluster(const sid_t    clusterId,
+                                              const uint32_t machines,
+                                              const double   power,
+                                              const double   loadFactor,
+                                              const int      cores,
+                                              const double   linkBandwidth,
+                                              const double   linkLoadFactor,
+                                              const double   linkLatency)
+{
+    insert(clusterId, Initializer::CLUSTER, m_Clusters.m_Machines.size());
+    m_Clusters.m_Machines.push_back(machines);
+    m_Clusters.m_Power.push_back(power);
+    m_Clusters.m_LoadFactor.push_back(loadFactor);
+    m_Clusters.m_Cores.push_back(cores);
+    m_Clusters.m_LinkBandwidth.push_back(linkBandwidth);
+    m_Clusters.m_LinkLoadFactor.push_back(linkLoadFactor);
+    m_Clusters.m_LinkLatency.push_back(linkLatency);
+}
+
+void ispd::sim::ServiceTable::registerDummy(const sid_t dummyId)
+{
+    insert(dummyId, Initializer::DUMMY, 0U);
+}
+
+void ispd::sim::ServiceTable::registerServiceFinalizer(
+    const sid_t serviceId, const std::function<void(Service *)> &serviceFinalizer)
+{
+    if (serviceId >= m_FinalizerIndices.size())
+        m_FinalizerIndices.resize(serviceId + 1, NoFinalizer);
+
+    // It checks if a service finalizer with that id has already been
+    // registered. If so, then the program is immediately aborted.
+    if (UNLIKELY(m_FinalizerIndices[serviceId] != NoFinalizer))
+        die("A service with id %lu has already been registered.", serviceId);
+
+    if (UNLIKELY(m_Finalizers.size() >= NoFinalizer))
+        die("At most %u service finalizers can be registered.", NoFinalizer);
+
+    m_FinalizerIndices[serviceId] = static_cast<uint32_t>(m_Finalizers.size());
+    m_Finalizers.push_back(serviceFinalizer);
+}
+
+ServiceKind ispd::sim::ServiceTable::getKind(const sid_t serviceId) const
+{
+    // It checks if no service has been registered with that id.
+    if (UNLIKELY(serviceId >= m_Entries.size() ||
+                 m_Entries[serviceId].m_Kind == Initializer::NONE))
+        die("Service with id %llu has not been found.", serviceId);
+
+    switch (m_Entries[serviceId].m_Kind) {
+    case Initializer::MACHINE:
+        return ServiceKind::MACHINE;
+    case Initializer::LINK:
+        return ServiceKind::LINK;
+    case Initializer::SWITCH:
+        return ServiceKind::SWITCH;
+    case Initializer::DUMMY:
+        return ServiceKind::DUMMY;
+    case Initializer::CLUSTER:
+        return ServiceKind::CLUSTER;
+    case Initializer::SHARING_MACHINE:
+        return ServiceKind::SHARING_MACHINE;
+    default:
+        return ServiceKind::USER;
+    }
+}
+
+Service *ispd::sim::ServiceTable::initialize(const sid_t serviceId) const
+{
+    // It checks if no service has been registered with that id.
+    if (UNLIKELY(serviceId >= m_Entries.size() ||
+                 m_Entries[serviceId].m_Kind == Initializer::NONE))
+        die("Service with id %llu has not been found.", serviceId);
+
+    const Entry &entry   = m_Entries[serviceId];
+    const auto   i       = entry.m_Index;
+    Service     *service = nullptr;
+
+    switch (entry.m_Kind) {
+    case Initializer::GENERIC:
+        service = m_Generic[i]();
+        break;
+    case Initializer::MACHINE:
+        service = ROOTSimAllocator<>::construct<Machine>(
+            serviceId,
+            m_Machines.m_Power[i],
+            m_Machines.m_LoadFactor[i],
+            m_Machines.m_Cores[i],
+            m_Machines.m_CoreSelection[i]);
+        break;
+    case Initializer::SHARING_MACHINE:
+        service = ROOTSimAllocator<>::construct<SharingMachine>(
+            serviceId,
+            m_Machines.m_Power[i],
+            m_Machines.m_LoadFactor[i],
+            m_Machines.m_Cores[i]);
+        break;
+    case Initializer::LINK:
+        service = ROOTSimAllocator<>::construct<Link>(serviceId,
+                                                      m_Links.m_From[i],
+                                                      m_Links.m_To[i],
+                                                      m_Links.m_Bandwidth[i],
+                                                      m_Links.m_LoadFactor[i],
+                                                      m_Links.m_Latency[i],
+                                                      m_Links.m_Duplex[i]);
+        break;
+    case Initializer::SWITCH:
+        service =
+            ROOTSimAllocator<>::construct<Switch>(serviceId,
+                                                  m_Switches.m_Bandwidth[i],
+                                                  m_Switches.m_LoadFactor[i],
+                                                  m_Switches.m_Latency[i]);
+        break;
+    case Initializer::DUMMY:
+        service = ROOTSimAllocator<>::construct<Dummy>(serviceId);
+        break;
+    case Initializer::CLUSTER:
+        service = ROOTSimAllocator<>::construct<Cluster>(
+            serviceId,
+            m_Clusters.m_Machines[i],
+            m_Clusters.m_Power[i],
+            m_Clusters.m_LoadFactor[i],
+            m_Clusters.m_Cores[i],
+            m_Clusters.m_LinkBandwidth[i],
+            m_Clusters.m_LinkLoadFactor[i],
+            m_Clusters.m_LinkLatency[i]);
+        break;
+    default:
+        die("Unknown service initializer kind (%u).", entry.m_Kind);
+    }
+
+    // It checks if the service with the specified identifier has been
+    // generated by a service initializer with another identifier. If
+    // so, the program will be immediately aborted.
+    if (UNLIKELY(service->getId() != serviceId))
+        die("Service with id %llu has been generated by the service "
+            "initializer with id %llu.\n",
+            service->getId(),
+            serviceId);
+
+    return service;
+}
+
+void ispd::sim::ServiceTable::finalize(const sid_t serviceId,
+                                       Service    *service) const
+{
+    if (serviceId >= m_FinalizerIndices.size() ||
+        m_FinalizerIndices[serviceId] == NoFinalizer)
+        return;
+
+    m_Finalizers[m_FinalizerIndices[serviceId]](service);
+}
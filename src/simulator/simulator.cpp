@@ -1,3 +1,6 @@
+#include <simulator/conservative.hpp>
+#include <simulator/native.hpp>
+#include <simulator/optimistic.hpp>
 #include <simulator/rootsim.hpp>
 #include <simulator/simulator.hpp>
 
@@ -39,7 +42,7 @@ Simulator *SimulatorBuilder::createSimulator()
         // aborted.
         if (m_Mode == SimulationMode::CONSERVATIVE)
             die("ROOT-Sim does not implement the conservative synchronization "
-                "protocol.");
+                "protocol. Use the native simulator instead.");
 
         struct simulation_configuration conf = {
             .n_threads        = m_Cores,
@@ -63,6 +66,20 @@ Simulator *SimulatorBuilder::createSimulator()
 
         break;
     }
+    case SimulatorType::NATIVE: {
+        switch (m_Mode) {
+        case SimulationMode::SEQUENTIAL:
+            return new NativeSimulator(0ULL);
+        case SimulationMode::OPTIMISTIC:
+            return new OptimisticSimulator(m_Cores, m_BatchSize, 0ULL);
+        case SimulationMode::CONSERVATIVE:
+            return new ConservativeSimulator(m_Cores, 0ULL);
+        default:
+            die("Unknown simulation type (%lu).", m_Mode);
+        }
+
+        break;
+    }
     default:
         die("Unknown simulator type (%lu).", m_Type);
     }
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <engine.hpp>
+#include <random>
+#include <service/core_scheduler.hpp>
+#include <tclap/ArgException.h>
+#include <tclap/CmdLine.h>
+#include <vector>
+
+/// \brief The amount of precomputed inter-arrival and service times, which are
+///        reused in a cycle, such that, the random number generation is not
+///        measured.
+static constexpr std::size_t SampleCount = 1U << 16U;
+
+/// \brief The cores' free times scanned by the specified kernel, which has
+///        the same interface as the core scheduler.
+template <int (*Kernel)(const timestamp_t *, int)>
+class LinearScan
+{
+public:
+    explicit LinearScan(const int cores) : m_FreeTimes(cores, 0.0)
+    {}
+
+    int getEarliestCore() const
+    {
+        return Kernel(m_FreeTimes.data(), static_cast<int>(m_FreeTimes.size()));
+    }
+
+    timestamp_t getFreeTime(const int core) const
+    {
+        return m_FreeTimes[core];
+    }
+
+    void setFreeTime(const int core, const timestamp_t time)
+    {
+        m_FreeTimes[core] = time;
+    }
+
+private:
+    std::vector<timestamp_t> m_FreeTimes;
+};
+
+/// \brief Run the task arrivals of a machine over the specified core
+///        selection, as done by `Machine::onTaskArrival`.
+///
+/// The tasks arrive with exponentially distributed inter-arrival times whose
+/// mean is the mean service time divided by the amount of cores, such that,
+/// the machine is kept fully utilized and the cores' free times are close.
+///
+/// \param scheduler The core selection to be measured.
+/// \param arrivals The amount of task arrivals to be executed.
+/// \param gaps The precomputed inter-arrival times.
+/// \param services The precomputed service times.
+///
+/// \return The average time (in nanoseconds) of a task arrival.
+template <typename Scheduler>
+static double arrive(Scheduler                 &scheduler,
+                     const uint64_t             arrivals,
+                     const std::vector<double> &gaps,
+                     const std::vector<double> &services)
+{
+    timestamp_t time     = 0.0;
+    uint64_t    checksum = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < arrivals; i++) {
+        const std::size_t sample = i % SampleCount;
+        const int         core   = scheduler.getEarliestCore();
+        const timestamp_t free   = scheduler.getFreeTime(core);
+
+        time += gaps[sample];
+        scheduler.setFreeTime(core, std::max(free, time) + services[sample]);
+        checksum += static_cast<uint64_t>(core);
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    // The checksum is kept alive, such that, the loop is not optimized away.
+    if (checksum == UINT64_MAX)
+        std::puts("");
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           arrivals;
+}
+
+int main(int argc, char **argv)
+{
+    try {
+        // Construct the command-line parser.
+        TCLAP::CmdLine cmd("Core Selection Benchmark", ' ', "v0.0.1");
+
+        // Argument to specify the greatest amount of cores.
+        TCLAP::ValueArg<int> coresArg(
+            "c",
+            "cores",
+            "Specify the greatest amount of cores.",
+            false,
+            1024,
+            "int");
+        cmd.add(coresArg);
+
+        // Argument to specify the amount of task arrivals per measurement.
+        TCLAP::ValueArg<uint64_t> arrivalsArg(
+            "a",
+            "arrivals",
+            "Specify the amount of task arrivals per measurement.",
+            false,
+            4000000,
+            "uint64_t");
+        cmd.add(arrivalsArg);
+
+        // Parse the command-line arguments.
+        cmd.parse(argc, argv);
+
+        // The core schedulers are allocated as if the native engine were
+        // progressing the simulation.
+        ispd::native::g_Active = true;
+
+        std::printf("Vector instructions: %s\n", getEarliestCoreKernelName());
+        std::printf("Tournament threshold: %d cores\n",
+                    getTournamentThreshold());
+        std::printf("%8s %14s %14s %16s\n",
+                    "Cores",
+                    "Scalar (ns)",
+                    "Vector (ns)",
+                    "Tournament (ns)");
+
+        for (int cores = 2; cores <= coresArg.getValue(); cores *= 2) {
+            std::mt19937_64                       engine(0);
+            std::exponential_distribution<double> exp(1.0);
+            std::vector<double>                   gaps(SampleCount);
+            std::vector<double>                   services(SampleCount);
+
+            for (std::size_t i = 0; i < SampleCount; i++) {
+                gaps[i]     = exp(engine) / cores;
+                services[i] = exp(engine);
+            }
+
+            LinearScan<findEarliestCoreScalar> scalar(cores);
+            LinearScan<findEarliestCoreVector> vector(cores);
+            CoreScheduler tournament(cores, CoreSelection::TOURNAMENT_TREE);
+
+            const uint64_t arrivals = arrivalsArg.getValue();
+
+            std::printf("%8d %14.2lf %14.2lf %16.2lf\n",
+                        cores,
+                        arrive(scalar, arrivals, gaps, services),
+                        arrive(vector, arrivals, gaps, services),
+                        arrive(tournament, arrivals, gaps, services));
+        }
+    }
+    catch (const TCLAP::ArgException &e) {
+        std::cerr << "Error " << e.error() << " in argument " << e.argId()
+                  << "." << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <simulator/event_set.hpp>
+#include <simulator/ladder_queue.hpp>
+#include <tclap/ArgException.h>
+#include <tclap/CmdLine.h>
+
+using namespace ispd::sim;
+
+/// \brief Run the classic hold model over the specified pending event set.
+///
+/// The pending event set is first filled with a burst of events at t = 0, as
+/// the constant-sized workloads do, and then each dequeued event schedules a
+/// new one with an exponentially distributed increment, keeping the amount of
+/// pending events constant.
+///
+/// \param size The amount of pending events.
+/// \param holds The amount of dequeue/enqueue pairs to be executed.
+///
+/// \return The average time (in nanoseconds) of a dequeue/enqueue pair.
+template <typename EventSet>
+static double hold(const uint32_t size, const uint64_t holds)
+{
+    std::mt19937_64                       engine(0);
+    std::exponential_distribution<double> exp(1.0);
+    EventSet                              set;
+    uint64_t                              sequence = 0;
+
+    for (uint32_t i = 0; i < size; i++)
+        set.push(PendingEvent{toEventTime(0.0), sequence++, 0U, i});
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < holds; i++) {
+        const PendingEvent event = set.pop();
+        set.push(PendingEvent{
+            toEventTime(fromEventTime(event.m_Time) + exp(engine)),
+            sequence++,
+            0U,
+            event.m_Slot});
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           holds;
+}
+
+/// \brief Check that the ladder queue dequeues the same events in the same
+///        order as the binary heap.
+///
+/// The events are scheduled by several sources at a few distinct timestamps,
+/// such that, most of them are tied, and each dequeued event schedules new
+/// ones, possibly at its own timestamp, while the ties are being dequeued.
+///
+/// \param rounds The amount of independent rounds to be checked.
+///
+/// \return true if both pending event sets agree in every round; otherwise,
+///         false.
+static bool check(const uint32_t rounds)
+{
+    constexpr uint32_t Sources = 16;
+
+    std::mt19937_64 engine(0);
+
+    for (uint32_t round = 0; round < rounds; round++) {
+        BinaryHeapEventSet  heap;
+        LadderQueueEventSet ladder;
+        uint64_t            sequences[Sources] = {};
+        uint32_t            slot               = 0;
+
+        const auto schedule = [&](const timestamp_t time) {
+            const uint32_t     source = engine() % Sources;
+            const PendingEvent event{
+                toEventTime(time), sequences[source]++, source, slot++};
+
+            heap.push(event);
+            ladder.push(event);
+        };
+
+        // The initial burst is large enough, in some rounds, to be spread
+        // over the ladder's rungs.
+        const uint64_t burst = engine() % 400;
+
+        for (uint64_t i = 0; i < burst; i++)
+            schedule(static_cast<timestamp_t>(engine() % 8));
+
+        while (!heap.empty()) {
+            const PendingEvent expected = heap.pop();
+            const PendingEvent actual   = ladder.pop();
+
+            if (actual.m_Slot != expected.m_Slot) {
+                std::fprintf(stderr,
+                             "Round %u: the ladder queue has dequeued the "
+                             "event %u instead of the event %u.\n",
+                             round,
+                             actual.m_Slot,
+                             expected.m_Slot);
+                return false;
+            }
+
+            const timestamp_t now = fromEventTime(expected.m_Time);
+
+            // The new events are scheduled at the current timestamp or a few
+            // half-seconds later, until enough events have been scheduled.
+            const uint64_t count = slot < 4000 ? engine() % 3 : 0;
+
+            for (uint64_t i = 0; i < count; i++)
+                schedule(now + 0.5 * static_cast<timestamp_t>(engine() % 4));
+        }
+
+        if (!ladder.empty()) {
+            std::fprintf(stderr,
+                         "Round %u: the ladder queue has events left.\n",
+                         round);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    try {
+        // Construct the command-line parser.
+        TCLAP::CmdLine cmd("Pending Event Set Benchmark", ' ', "v0.0.1");
+
+        // Argument to specify the greatest amount of pending events.
+        TCLAP::ValueArg<uint32_t> sizeArg(
+            "e",
+            "events",
+            "Specify the greatest amount of pending events.",
+            false,
+            10000000,
+            "uint32_t");
+        cmd.add(sizeArg);
+
+        // Switch to only check that both pending event sets agree.
+        TCLAP::SwitchArg checkArg(
+            "c",
+            "check",
+            "Check that both pending event sets dequeue the same events in "
+            "the same order, instead of measuring them.",
+            false);
+        cmd.add(checkArg);
+
+        // Parse the command-line arguments.
+        cmd.parse(argc, argv);
+
+        if (checkArg.getValue()) {
+            if (!check(500))
+                return 1;
+
+            std::printf("Both pending event sets agree.\n");
+            return 0;
+        }
+
+        std::printf("%12s %16s %16s\n", "Events", "Heap (ns)", "Ladder (ns)");
+
+        for (uint32_t size = 1000; size <= sizeArg.getValue(); size *= 10) {
+            const uint64_t holds = 4ULL * size;
+
+            std::printf("%12u %16.2lf %16.2lf\n",
+                        size,
+                        hold<BinaryHeapEventSet>(size, holds),
+                        hold<LadderQueueEventSet>(size, holds));
+        }
+    }
+    catch (const TCLAP::ArgException &e) {
+        std::cerr << "Error " << e.error() << " in argument " << e.argId()
+                  << "." << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/bin/sh
+#
+# Compare the native engine's pending event sets on the topology models.
+#
+# Usage: benchmark_event_set/run.sh <build-dir> [tasks] [machines]
+#
+# It must be executed from the `test` directory, since the topology models
+# write their routing files relative to it.
+
+BUILD_DIR=${1:?"Usage: $0 <build-dir> [tasks] [machines]"}
+TASKS=${2:-100000}
+MACHINES=${3:-100}
+
+elapsed() {
+    start=$(date +%s%N)
+    "$@" > /dev/null 2>&1 || echo "'$*' has failed" >&2
+    end=$(date +%s%N)
+    echo $(( (end - start) / 1000000 ))
+}
+
+printf "%-24s %12s %12s\n" "Model" "Heap (ms)" "Ladder (ms)"
+
+for model in topology_linear topology_ring topology_star topology_tree \
+             topology_star_switched; do
+    heap=$(elapsed "$BUILD_DIR/test_$model" -s -n -t "$TASKS" -m "$MACHINES")
+    ladder=$(elapsed "$BUILD_DIR/benchmark_${model}_ladder" -s -n \
+             -t "$TASKS" -m "$MACHINES")
+    printf "%-24s %12s %12s\n" "$model" "$heap" "$ladder"
+done
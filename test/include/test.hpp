@@ -3,8 +3,11 @@
 
 #include <core/core.hpp>
 #include <cstdio>
+#include <service/cluster.hpp>
+#include <service/link.hpp>
 #include <service/machine.hpp>
 #include <service/master.hpp>
+#include <service/sharing_machine.hpp>
 #include <service/switch.hpp>
 #include <simulator/simulator.hpp>
 
@@ -65,7 +68,8 @@ inline void registerMasterServiceFinalizer(
 ///          machine service. It retrieves the metrics of the machine, including
 ///          the last activity time, processed MFLOPS, processed time, processed
 ///          tasks, and forwarded packets, and prints them to the console in a
-///          formatted manner.
+///          formatted manner. The processor-sharing machines are printed in
+///          the same format.
 inline void registerMachineServiceFinalizer(
     ispd::sim::Simulator *const simulator, const sid_t serviceId)
 {
@@ -75,8 +79,11 @@ inline void registerMachineServiceFinalizer(
         die("registerMachineServiceFinalizer: Simulator is NULL");
 
     simulator->registerServiceFinalizer(serviceId, [](Service *service) {
-        const Machine        *m       = static_cast<Machine *>(service);
-        const MachineMetrics &metrics = m->getMetrics();
+        const Service        *m       = service;
+        const MachineMetrics &metrics =
+            service->getKind() == ServiceKind::SHARING_MACHINE
+                ? static_cast<SharingMachine *>(service)->getMetrics()
+                : static_cast<Machine *>(service)->getMetrics();
 
         /// Print the machine metrics.
         std::printf("Machine Metrics\n"
@@ -99,6 +106,100 @@ inline void registerMachineServiceFinalizer(
     });
 }
 
+/// \brief Registers a cluster service finalizer that is used to print the
+///        statistics of every cluster's machine at the end of the simulation
+///        for the cluster with the specified service identifier.
+///
+/// \param simulator The simulator to which the service finalizer will be
+///                  registered.
+/// \param serviceId The service identifier of the cluster.
+///
+/// \note If the simulator is not specified (null), the program will be aborted.
+///
+/// \details The statistics are printed in the same format as the machines'
+///          ones, in the order of the cluster's machines, such that, the output
+///          of a model with a cluster may be compared with the output of the
+///          same model with its machines registered one by one.
+inline void registerClusterServiceFinalizer(
+    ispd::sim::Simulator *const simulator, const sid_t serviceId)
+{
+    /// It checks if the simulator has not been specified. If so, then
+    /// the program will be aborted immediately.
+    if (not simulator)
+        die("registerClusterServiceFinalizer: Simulator is NULL");
+
+    simulator->registerServiceFinalizer(serviceId, [](Service *service) {
+        const Cluster *c = static_cast<Cluster *>(service);
+
+        /// Print every machine's metrics.
+        for (uint32_t member = 0; member < c->getMachineCount(); member++) {
+            const MachineMetrics &metrics = c->getMachineMetrics(member);
+
+            std::printf("Machine Metrics\n"
+                        " - Last Activity Time: %lf @ LP (%lu)\n"
+                        " - Processed MFLOPS..: %lf @ LP (%lu)\n"
+                        " - Processed Time....: %lf @ LP (%lu)\n"
+                        " - Processed Tasks...: %d @ LP (%lu)\n"
+                        " - Forwarded Packets.: %u @ LP (%lu)\n"
+                        "\n",
+                        metrics.m_LastActivityTime,
+                        c->getId(),
+                        metrics.m_ProcMFlops,
+                        c->getId(),
+                        metrics.m_ProcTime,
+                        c->getId(),
+                        metrics.m_ProcTasks,
+                        c->getId(),
+                        metrics.m_ForwardedPackets,
+                        c->getId());
+        }
+    });
+}
+
+/// \brief Registers a link service finalizer that is used to print the link's
+///        statistics in each direction at the end of the simulation for the
+///        link with the specified service identifier.
+///
+/// \param simulator The simulator to which the service finalizer will be
+///                  registered.
+/// \param serviceId The service identifier of the link.
+///
+/// \note If the simulator is not specified (null), the program will be aborted.
+///
+/// \details Each statistic is printed as the value from the link's source to
+///          its destination, followed by the value from its destination to
+///          its source.
+inline void registerLinkServiceFinalizer(ispd::sim::Simulator *const simulator,
+                                         const sid_t serviceId)
+{
+    /// It checks if the simulator has not been specified. If so, then
+    /// the program will be aborted immediately.
+    if (not simulator)
+        die("registerLinkServiceFinalizer: Simulator is NULL");
+
+    simulator->registerServiceFinalizer(serviceId, [](Service *service) {
+        const Link        *l      = static_cast<Link *>(service);
+        const LinkMetrics &fromTo = l->getMetrics(LinkDirection::FROM_TO);
+        const LinkMetrics &toFrom = l->getMetrics(LinkDirection::TO_FROM);
+
+        /// Print the link metrics.
+        std::printf("Link Metrics\n"
+                    " - Communicated Mbits..: %lf / %lf @ LP (%lu)\n"
+                    " - Communicated Time...: %lf / %lf @ LP (%lu)\n"
+                    " - Communicated Packets: %.0lf / %.0lf @ LP (%lu)\n"
+                    "\n",
+                    fromTo.m_CommMBits,
+                    toFrom.m_CommMBits,
+                    l->getId(),
+                    fromTo.m_CommTime,
+                    toFrom.m_CommTime,
+                    l->getId(),
+                    fromTo.m_CommTasks,
+                    toFrom.m_CommTasks,
+                    l->getId());
+    });
+}
+
 inline void registerSwitchServiceFinalizer(
     ispd::sim::Simulator *const simulator, const sid_t serviceId)
 {
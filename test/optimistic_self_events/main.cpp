@@ -0,0 +1,129 @@
+#include "allocator/rootsim_allocator.hpp"
+#include <core/core.hpp>
+#include <limits>
+#include <model/builder.hpp>
+#include <routing/shortest_path.hpp>
+#include <simulator/simulator.hpp>
+#include <tclap/ArgException.h>
+#include <tclap/CmdLine.h>
+#include <test.hpp>
+
+using namespace ispd::sim;
+
+/// This model checks the events that a service schedules to itself at the
+/// current time, as the cluster and the processor-sharing machine do when they
+/// process a task with no processing size.
+///
+/// The master (0) sends the tasks through the link (1), the switch (2) and the
+/// link (5) to the processing service (4). The processing service's identifier
+/// is less than the one of the link from which it receives the tasks, such
+/// that, the events that it schedules to itself are ordered before the event
+/// that is being processed.
+int main(int argc, char **argv)
+{
+    try {
+        // Construct the command-line parser.
+        TCLAP::CmdLine cmd("Optimistic Self Events", ' ', "v0.0.1");
+
+        // Argument to specify the amount of cores to use to progress the
+        // simulation.
+        TCLAP::ValueArg<uint32_t> coresArg(
+            "c",
+            "cores",
+            "Specify the amount of cores to progress the simulation.",
+            false,
+            1,
+            "uint32_t");
+        cmd.add(coresArg);
+
+        // Argument to specify the amount of tasks to be generated.
+        TCLAP::ValueArg<uint32_t> taskArg(
+            "t",
+            "tasks",
+            "Specify the amount of tasks to be simulated.",
+            false,
+            50,
+            "uint32_t");
+        cmd.add(taskArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // sequential mode.
+        TCLAP::SwitchArg serialArg(
+            "s",
+            "serial",
+            "Progress the simulation in the sequential mode.",
+            false);
+        cmd.add(serialArg);
+
+        // Argument to specify if the tasks should be processed by a
+        // processor-sharing machine instead of a cluster.
+        TCLAP::SwitchArg sharingArg(
+            "P",
+            "processor-sharing",
+            "Process the tasks by a processor-sharing machine.",
+            false);
+        cmd.add(sharingArg);
+
+        // Parse the command-line arguments.
+        cmd.parse(argc, argv);
+
+        const uint32_t taskAmount = taskArg.getValue();
+        SimulationMode mode       = serialArg.getValue()
+                                        ? SimulationMode::SEQUENTIAL
+                                        : SimulationMode::OPTIMISTIC;
+
+        Simulator *s = SimulatorBuilder(SimulatorType::NATIVE, mode)
+                           .setThreads(coresArg.getValue())
+                           .createSimulator();
+
+        ispd::model::Builder builder(s);
+
+        // Register the master, whose tasks have no processing and no
+        // communication sizes.
+        builder.registerMaster(
+            0ULL,
+            ispd::model::MasterScheduler::ROUND_ROBIN,
+            [taskAmount](Master *m) {
+                m->m_Workload = ROOTSimAllocator<>::construct<ConstantWorkload>(
+                    taskAmount, 0.0, 0.0);
+                m->addSlave(4ULL);
+
+                /// It sends an event to the master to indicate that its
+                /// scheduling algorithm should be initialized.
+                ispd::schedule_event(
+                    m->getId(), 0.0, TASK_SCHEDULER_INIT, nullptr, 0);
+            });
+
+        // The cluster's access link takes no time, such that, the processed
+        // tasks are sent back at the time in which they have arrived.
+        if (sharingArg.getValue())
+            builder.registerSharingMachine(4ULL, 2.0, 0.0, 2);
+        else
+            builder.registerCluster(4ULL,
+                                    1,
+                                    2.0,
+                                    0.0,
+                                    2,
+                                    std::numeric_limits<double>::infinity(),
+                                    0.0,
+                                    0.0);
+
+        builder.registerLink(1ULL, 0ULL, 2ULL, 5.0, 0.0, 1.0);
+        builder.registerSwitch(2ULL, 100.0, 0.0, 0.0);
+        builder.registerDummy(3ULL);
+        builder.registerLink(5ULL, 2ULL, 4ULL, 5.0, 0.0, 1.0);
+
+        // Compute the routes on demand from the links registered above.
+        g_RouteProvider = new ShortestPathRouteProvider(s->getServiceTable());
+
+        ispd::test::registerMasterServiceFinalizer(s, 0ULL);
+
+        s->simulate();
+    }
+    catch (const TCLAP::ArgException &e) {
+        std::cerr << "Error " << e.error() << " in argument " << e.argId()
+                  << "." << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,311 @@
+#include <core/core.hpp>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <routing/table.hpp>
+#include <string>
+#include <sys/wait.h>
+#include <tclap/ArgException.h>
+#include <tclap/CmdLine.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/// \brief Returns the source and destination services of every route of the
+///        specified routing file in the text `.route` format.
+static std::vector<std::pair<uint32_t, uint32_t>>
+readRoutePairs(const std::string &filepath)
+{
+    std::ifstream                              file(filepath);
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    std::string                                line;
+
+    if (!file)
+        die("Routing file '%s' could not be opened", filepath.c_str());
+
+    while (std::getline(file, line)) {
+        unsigned src;
+        unsigned dest;
+
+        if (std::sscanf(line.c_str(), "%u %u", &src, &dest) == 2)
+            pairs.emplace_back(src, dest);
+    }
+
+    return pairs;
+}
+
+/// \brief Writes a routing file in the text `.route` format with the
+///        specified amount of random routes.
+///
+/// Some routes are defined again by a later line, which replaces them, some
+/// routes have equal-cost alternatives and some lines are blank, such that,
+/// the chunks parsed by each thread must be merged in the file's order.
+static void generateRoutes(const std::string &filepath, const uint32_t count)
+{
+    std::ofstream   file(filepath, std::ios::trunc);
+    std::mt19937_64 engine(0);
+
+    if (!file)
+        die("Routing file '%s' could not be created", filepath.c_str());
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (engine() % 50 == 0) {
+            file << '\n';
+            continue;
+        }
+
+        file << engine() % 1000 << ' ' << engine() % 1000;
+
+        const uint64_t alternatives = engine() % 10 == 0 ? 2 : 1;
+
+        for (uint64_t a = 0; a < alternatives; a++) {
+            if (a > 0)
+                file << " |";
+
+            // A route may only be direct if it has no alternatives.
+            const uint64_t hops = (alternatives > 1 ? 1 : 0) + engine() % 12;
+
+            for (uint64_t hop = 0; hop < hops; hop++)
+                file << ' ' << engine() % 100000;
+        }
+
+        file << '\n';
+    }
+}
+
+/// \brief Returns the content of the specified file.
+static std::vector<char> readBytes(const std::string &filepath)
+{
+    std::ifstream file(filepath, std::ios::binary);
+
+    if (!file)
+        die("File '%s' could not be opened", filepath.c_str());
+
+    return std::vector<char>(std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>());
+}
+
+/// \brief Writes the specified content to the specified file.
+static void writeBytes(const std::string &filepath,
+                       const std::vector<char> &bytes)
+{
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+    if (!file)
+        die("File '%s' could not be written", filepath.c_str());
+}
+
+/// \brief Compares the routes of both routing tables between every pair of
+///        services, hop by hop.
+///
+/// \note If the routes differ, the program is immediately aborted.
+static void compareTables(
+    const RoutingTable                               &expected,
+    const RoutingTable                               &actual,
+    const std::vector<std::pair<uint32_t, uint32_t>> &pairs)
+{
+    // It checks if the tables have different sizes. If so, the program is
+    // immediately aborted.
+    if (UNLIKELY(expected.getRoutesSize() != actual.getRoutesSize() ||
+                 expected.getAlternativesSize() !=
+                     actual.getAlternativesSize() ||
+                 expected.getPathsSize() != actual.getPathsSize()))
+        die("The tables have %zu/%zu/%zu and %zu/%zu/%zu routes, "
+            "alternatives and path elements.",
+            expected.getRoutesSize(),
+            expected.getAlternativesSize(),
+            expected.getPathsSize(),
+            actual.getRoutesSize(),
+            actual.getAlternativesSize(),
+            actual.getPathsSize());
+
+    for (const auto &[src, dest] : pairs) {
+        // A few flows are compared, such that, the alternatives selected by
+        // them are compared as well.
+        for (uint64_t flow = 0; flow < 8; flow++) {
+            const Route expectedRoute = expected.getRoute(src, dest, flow);
+            const Route actualRoute   = actual.getRoute(src, dest, flow);
+
+            if (UNLIKELY(expectedRoute.getLength() != actualRoute.getLength()))
+                die("The route from %u to %u has %zu hops, but %zu were "
+                    "expected.",
+                    src,
+                    dest,
+                    actualRoute.getLength(),
+                    expectedRoute.getLength());
+
+            for (std::size_t i = 0; i < expectedRoute.getLength(); i++)
+                if (UNLIKELY(expectedRoute[i] != actualRoute[i]))
+                    die("The route from %u to %u has the hop %u at offset %zu, "
+                        "but %u was expected.",
+                        src,
+                        dest,
+                        actualRoute[i],
+                        i,
+                        expectedRoute[i]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    try {
+        // Construct the command-line parser.
+        TCLAP::CmdLine cmd("Routing File", ' ', "v0.0.1");
+
+        // Argument to specify the routing file in the text format.
+        TCLAP::ValueArg<std::string> routesArg(
+            "r",
+            "routes",
+            "Specify the routing file in the text format.",
+            false,
+            "topology_star_switched/routes.route",
+            "path");
+        cmd.add(routesArg);
+
+        // Argument to specify where the binary routing file is written.
+        TCLAP::ValueArg<std::string> binaryArg(
+            "o",
+            "output",
+            "Specify where the binary routing file is written.",
+            true,
+            "",
+            "path");
+        cmd.add(binaryArg);
+
+        // Argument to specify the amount of threads used to parse the text
+        // routing file, which is compared with the file parsed by a single
+        // thread if more than one thread is used.
+        TCLAP::ValueArg<uint32_t> threadsArg(
+            "t",
+            "threads",
+            "Specify the amount of threads used to parse the routing file.",
+            false,
+            1,
+            "uint32_t");
+        cmd.add(threadsArg);
+
+        // Argument to specify the amount of random routes that are written to
+        // the text routing file before it is read.
+        TCLAP::ValueArg<uint32_t> generateArg(
+            "g",
+            "generate",
+            "Write the specified amount of random routes to the routing file.",
+            false,
+            0,
+            "uint32_t");
+        cmd.add(generateArg);
+
+        // Argument to specify how the binary routing file is damaged before
+        // being mapped, which must be rejected by the mapping.
+        TCLAP::ValueArg<std::string> damageArg(
+            "D",
+            "damage",
+            "Damage the binary routing file before mapping it (truncate or "
+            "corrupt).",
+            false,
+            "",
+            "truncate|corrupt");
+        cmd.add(damageArg);
+
+        // Parse the command-line arguments.
+        cmd.parse(argc, argv);
+
+        const std::string &routes = routesArg.getValue();
+        const std::string &binary = binaryArg.getValue();
+        const std::string &damage = damageArg.getValue();
+
+        if (generateArg.getValue() > 0)
+            generateRoutes(routes, generateArg.getValue());
+
+        const auto pairs = readRoutePairs(routes);
+
+        RoutingTable *text =
+            RoutingTableReader().read(routes, threadsArg.getValue());
+
+        // The chunks parsed by each thread must be merged as if the file had
+        // been parsed by a single thread.
+        if (threadsArg.getValue() > 1) {
+            RoutingTable *sequential = RoutingTableReader().read(routes, 1);
+            compareTables(*sequential, *text, pairs);
+
+            std::printf("The routing file parsed by %u threads matches the "
+                        "one parsed by a single thread.\n",
+                        threadsArg.getValue());
+            delete sequential;
+        }
+
+        text->write(binary);
+
+        if (!damage.empty()) {
+            std::vector<char> bytes = readBytes(binary);
+
+            // The file is either truncated by a path element, or the offset
+            // of the first source's routes is corrupted, which is only found
+            // when the arrays are checked.
+            if (damage == "truncate")
+                bytes.resize(bytes.size() - sizeof(uint32_t));
+            else if (damage == "corrupt") {
+                const auto *header =
+                    reinterpret_cast<const RoutingFileHeader *>(bytes.data());
+                const std::size_t offset =
+                    ((sizeof(RoutingFileHeader) + 7ULL) & ~7ULL) +
+                    ((header->m_SourceCount * sizeof(uint32_t) + 7ULL) & ~7ULL);
+
+                bytes[offset] ^= 1;
+            }
+            else
+                die("Unknown damage '%s'.", damage.c_str());
+
+            writeBytes(binary, bytes);
+
+            // The damaged file is mapped by a child process, since the
+            // program is aborted when the file is rejected.
+            const pid_t child = fork();
+
+            if (child == 0) {
+                RoutingTable::map(binary);
+                _exit(0);
+            }
+
+            int status;
+            waitpid(child, &status, 0);
+
+            if (UNLIKELY(!WIFSIGNALED(status) || WTERMSIG(status) != SIGABRT))
+                die("The damaged binary routing file has been mapped.");
+
+            std::printf("The damaged binary routing file has been rejected.\n");
+
+            delete text;
+            return 0;
+        }
+
+        RoutingTable *mapped = RoutingTable::map(binary);
+
+        // The mapped table is written again, which must produce the same
+        // binary routing file.
+        const std::string rewritten = binary + ".rewritten";
+        mapped->write(rewritten);
+
+        if (UNLIKELY(readBytes(binary) != readBytes(rewritten)))
+            die("The mapped routing table has not been written identically.");
+
+        compareTables(*text, *mapped, pairs);
+
+        std::printf("The binary routing table matches the text one (%zu "
+                    "routes).\n",
+                    mapped->getRoutesSize());
+
+        delete mapped;
+        delete text;
+    }
+    catch (const TCLAP::ArgException &e) {
+        std::cerr << "Error " << e.error() << " in argument " << e.argId()
+                  << "." << std::endl;
+    }
+
+    return 0;
+}
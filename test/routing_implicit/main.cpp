@@ -0,0 +1,332 @@
+#include <core/core.hpp>
+#include <cstdio>
+#include <routing/implicit.hpp>
+#include <routing/shortest_path.hpp>
+#include <simulator/service_table.hpp>
+#include <vector>
+
+using namespace ispd::sim;
+
+/// \brief Appends the shortest route between the specified services to the
+///        specified path.
+///
+/// It is used to build the reference routes only from the links registered in
+/// the service table. Whenever the implicit provider selects one of several
+/// routes of the same length, the reference route is split at the services
+/// that the provider is expected to pass through, such that, each part is
+/// the only shortest route between its ends.
+static void appendShortestRoute(const ShortestPathRouteProvider &reference,
+                                const uint32_t                   src,
+                                const uint32_t                   dest,
+                                std::vector<uint32_t>           &path)
+{
+    const Route route = reference.getRoute(src, dest);
+
+    for (std::size_t offset = 0; offset < route.getLength(); offset++)
+        path.push_back(route[offset]);
+}
+
+/// \brief Compares the route of the implicit provider between the specified
+///        services against the expected route, hop by hop.
+///
+/// \note If the routes differ, the program is immediately aborted.
+static void compareRoute(const char                  *topology,
+                         const ImplicitRouteProvider &provider,
+                         const uint32_t               src,
+                         const uint32_t               dest,
+                         const std::vector<uint32_t> &expected)
+{
+    const std::size_t length = provider.getLength(src, dest);
+
+    // It checks if the routes have different lengths. If so, the program is
+    // immediately aborted.
+    if (UNLIKELY(length != expected.size()))
+        die("%s: the route from %u to %u has %zu hops, but %zu were expected.",
+            topology,
+            src,
+            dest,
+            length,
+            expected.size());
+
+    // The materialized route is compared as well, since it is built from the
+    // hops in the calling thread's buffer.
+    const Route route = provider.getRoute(src, dest);
+
+    for (std::size_t offset = 0; offset < length; offset++) {
+        const uint32_t hop = provider.getHop(src, dest, offset);
+
+        if (UNLIKELY(hop != expected[offset] || route[offset] != hop))
+            die("%s: the route from %u to %u has the hop %u at offset %zu, but "
+                "%u was expected.",
+                topology,
+                src,
+                dest,
+                hop,
+                offset,
+                expected[offset]);
+    }
+}
+
+/// \brief Compares the complete k-ary tree routes against the shortest routes,
+///        which are unique in a tree.
+static void testKaryTree(const uint32_t nodeCount, const uint32_t arity)
+{
+    ServiceTable services;
+
+    for (uint32_t node = 0; node < nodeCount; node++) {
+        services.registerMachine(2ULL * node, 1.0, 0.0, 1);
+
+        if (node > 0U)
+            services.registerLink(2ULL * node - 1ULL,
+                                  2ULL * ((node - 1U) / arity),
+                                  2ULL * node,
+                                  1.0,
+                                  0.0,
+                                  0.0);
+    }
+
+    const KaryTreeRouteProvider     provider(nodeCount, arity);
+    const ShortestPathRouteProvider reference(services);
+    std::vector<uint32_t>           expected;
+    std::size_t                     routes = 0U;
+
+    for (uint32_t a = 0; a < nodeCount; a++)
+        for (uint32_t b = 0; b < nodeCount; b++) {
+            if (a == b)
+                continue;
+
+            expected.clear();
+            appendShortestRoute(reference, 2U * a, 2U * b, expected);
+            compareRoute("KaryTree", provider, 2U * a, 2U * b, expected);
+            routes++;
+        }
+
+    std::printf("KaryTree (%u nodes, arity %u): %zu routes match\n",
+                nodeCount,
+                arity,
+                routes);
+}
+
+/// \brief Compares the torus (or mesh) routes against the shortest routes
+///        between the corners of the dimension-ordered route.
+///
+/// Each part of the route changes a single coordinate. Therefore, it is the
+/// only shortest route between its ends, as long as each torus' extent is
+/// odd and at least 3, such that, there are no ties between the directions
+/// and no parallel links.
+static void testTorus(const uint32_t  dimensions,
+                      const uint32_t *extents,
+                      const bool      wraparound)
+{
+    uint32_t size[3]   = {1U, 1U, 1U};
+    uint32_t nodeCount = 1U;
+
+    for (uint32_t d = 0; d < dimensions; d++) {
+        size[d]    = extents[d];
+        nodeCount *= extents[d];
+    }
+
+    const uint32_t stride = dimensions + 1U;
+
+    const auto toNode = [&](const uint32_t *coordinates) {
+        return coordinates[0] +
+               size[0] * (coordinates[1] + size[1] * coordinates[2]);
+    };
+
+    const auto toCoordinates = [&](const uint32_t node, uint32_t *coordinates) {
+        coordinates[0] = node % size[0];
+        coordinates[1] = node / size[0] % size[1];
+        coordinates[2] = node / size[0] / size[1];
+    };
+
+    ServiceTable services;
+
+    for (uint32_t node = 0; node < nodeCount; node++)
+        services.registerMachine(stride * node, 1.0, 0.0, 1);
+
+    // The link towards the successor in each dimension is registered, unless
+    // the node is the last one of that dimension in the mesh.
+    for (uint32_t node = 0; node < nodeCount; node++) {
+        uint32_t coordinates[3];
+        toCoordinates(node, coordinates);
+
+        for (uint32_t d = 0; d < dimensions; d++) {
+            if (!wraparound && coordinates[d] + 1U == size[d])
+                continue;
+
+            uint32_t successor[3];
+            toCoordinates(node, successor);
+            successor[d] = (coordinates[d] + 1U) % size[d];
+
+            services.registerLink(stride * node + 1U + d,
+                                  stride * node,
+                                  stride * toNode(successor),
+                                  1.0,
+                                  0.0,
+                                  0.0);
+        }
+    }
+
+    const TorusRouteProvider        provider(dimensions, extents, wraparound);
+    const ShortestPathRouteProvider reference(services);
+    std::vector<uint32_t>           expected;
+    std::size_t                     routes = 0U;
+
+    for (uint32_t a = 0; a < nodeCount; a++)
+        for (uint32_t b = 0; b < nodeCount; b++) {
+            if (a == b)
+                continue;
+
+            uint32_t position[3];
+            uint32_t target[3];
+
+            toCoordinates(a, position);
+            toCoordinates(b, target);
+
+            expected.clear();
+
+            // The packet is routed in each dimension in order, therefore,
+            // each corner takes the destination's coordinate in one more
+            // dimension.
+            for (uint32_t d = 0; d < dimensions; d++) {
+                if (position[d] == target[d])
+                    continue;
+
+                const uint32_t from = stride * toNode(position);
+                position[d]         = target[d];
+
+                appendShortestRoute(
+                    reference, from, stride * toNode(position), expected);
+            }
+
+            compareRoute("Torus", provider, stride * a, stride * b, expected);
+            routes++;
+        }
+
+    std::printf("%s (%u x %u x %u): %zu routes match\n",
+                wraparound ? "Torus" : "Mesh",
+                size[0],
+                size[1],
+                size[2],
+                routes);
+}
+
+/// \brief Compares the fat-tree routes against the shortest routes through
+///        the aggregation and core switches selected by the destination.
+///
+/// There are several shortest routes between hosts of different edge
+/// switches. However, from a host to an aggregation switch of its pod, and
+/// from an aggregation switch to a core switch, the shortest route is unique.
+static void testFatTree(const uint32_t arity)
+{
+    const FatTreeRouteProvider provider(arity);
+    const uint32_t             half  = arity / 2U;
+    const uint32_t             hosts = provider.getHostCount();
+
+    ServiceTable services;
+
+    for (uint32_t host = 0; host < hosts; host++)
+        services.registerMachine(provider.getHostId(host), 1.0, 0.0, 1);
+
+    for (uint32_t pod = 0; pod < arity; pod++)
+        for (uint32_t i = 0; i < half; i++) {
+            services.registerSwitch(
+                provider.getEdgeSwitchId(pod, i), 1.0, 0.0, 0.0);
+            services.registerSwitch(
+                provider.getAggregationSwitchId(pod, i), 1.0, 0.0, 0.0);
+        }
+
+    for (uint32_t aggr = 0; aggr < half; aggr++)
+        for (uint32_t port = 0; port < half; port++)
+            services.registerSwitch(
+                provider.getCoreSwitchId(aggr, port), 1.0, 0.0, 0.0);
+
+    for (uint32_t host = 0; host < hosts; host++)
+        services.registerLink(
+            provider.getHostLinkId(host),
+            provider.getHostId(host),
+            provider.getEdgeSwitchId(host / (half * half), host / half % half),
+            1.0,
+            0.0,
+            0.0);
+
+    for (uint32_t pod = 0; pod < arity; pod++)
+        for (uint32_t i = 0; i < half; i++)
+            for (uint32_t j = 0; j < half; j++) {
+                services.registerLink(provider.getEdgeLinkId(pod, i, j),
+                                      provider.getEdgeSwitchId(pod, i),
+                                      provider.getAggregationSwitchId(pod, j),
+                                      1.0,
+                                      0.0,
+                                      0.0);
+                services.registerLink(provider.getCoreLinkId(pod, i, j),
+                                      provider.getAggregationSwitchId(pod, i),
+                                      provider.getCoreSwitchId(i, j),
+                                      1.0,
+                                      0.0,
+                                      0.0);
+            }
+
+    const ShortestPathRouteProvider reference(services);
+    std::vector<uint32_t>           expected;
+    std::size_t                     routes = 0U;
+
+    for (uint32_t a = 0; a < hosts; a++)
+        for (uint32_t b = 0; b < hosts; b++) {
+            if (a == b)
+                continue;
+
+            const uint32_t podA = a / (half * half);
+            const uint32_t podB = b / (half * half);
+            const uint32_t aggr = b % half;
+            const uint32_t port = b / half % half;
+
+            const uint32_t up   = provider.getAggregationSwitchId(podA, aggr);
+            const uint32_t down = provider.getAggregationSwitchId(podB, aggr);
+            const uint32_t core = provider.getCoreSwitchId(aggr, port);
+
+            expected.clear();
+
+            // The hosts of the same edge switch have a unique route. Otherwise,
+            // the route passes through the selected aggregation switches and,
+            // between different pods, through the selected core switch.
+            if (a / half == b / half)
+                appendShortestRoute(reference, a, b, expected);
+            else if (podA == podB) {
+                appendShortestRoute(reference, a, up, expected);
+                appendShortestRoute(reference, up, b, expected);
+            }
+            else {
+                appendShortestRoute(reference, a, up, expected);
+                appendShortestRoute(reference, up, core, expected);
+                appendShortestRoute(reference, core, down, expected);
+                appendShortestRoute(reference, down, b, expected);
+            }
+
+            compareRoute("FatTree", provider, a, b, expected);
+            routes++;
+        }
+
+    std::printf("FatTree (arity %u): %zu routes match\n", arity, routes);
+}
+
+int main()
+{
+    testKaryTree(31U, 2U);
+    testKaryTree(40U, 3U);
+
+    const uint32_t torus2d[] = {5U, 3U};
+    const uint32_t torus3d[] = {3U, 5U, 3U};
+    const uint32_t mesh2d[]  = {4U, 3U};
+    const uint32_t mesh3d[]  = {2U, 4U, 3U};
+
+    testTorus(2U, torus2d, true);
+    testTorus(3U, torus3d, true);
+    testTorus(2U, mesh2d, false);
+    testTorus(3U, mesh3d, false);
+
+    testFatTree(4U);
+    testFatTree(6U);
+
+    return 0;
+}
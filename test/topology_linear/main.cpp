@@ -1,6 +1,7 @@
 #include <core/core.hpp>
 #include <fstream>
 #include <model/builder.hpp>
+#include <routing/implicit.hpp>
 #include <routing/table.hpp>
 #include <simulator/simulator.hpp>
 #include <string>
@@ -10,7 +11,6 @@
 
 #define DEFAULT_ROUTE_FILENAME "topology_linear/routes.route"
 
-extern RoutingTable *g_RoutingTable;
 
 using namespace ispd::sim;
 
@@ -124,6 +124,34 @@ int main(int argc, char **argv)
             "b", "core-binding", "Enable the thread-to-core binding.", false);
         cmd.add(coreBindingArg);
 
+        // Argument to specify if the simulation should be progressed by the
+        // native engine instead of the ROOT-Sim.
+        TCLAP::SwitchArg nativeArg(
+            "n",
+            "native",
+            "Progress the simulation using the native engine.",
+            false);
+        cmd.add(nativeArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // conservative mode.
+        TCLAP::SwitchArg conservativeArg(
+            "C",
+            "conservative",
+            "Progress the simulation in the conservative mode.",
+            false);
+        cmd.add(conservativeArg);
+
+        // Argument to specify if the routes should be computed in a closed
+        // form from the services' identifiers instead of read from the
+        // routing file.
+        TCLAP::SwitchArg implicitArg(
+            "r",
+            "implicit-routes",
+            "Compute the routes from the services' identifiers.",
+            false);
+        cmd.add(implicitArg);
+
         // Parse the command-line arguments.
         cmd.parse(argc, argv);
 
@@ -131,13 +159,27 @@ int main(int argc, char **argv)
         uint32_t       machineAmount = machineArg.getValue();
         SimulationMode mode = serialArg.getValue() ? SimulationMode::SEQUENTIAL
                                                    : SimulationMode::OPTIMISTIC;
-
-        createLinearTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
-
-        // Read the routing table from the specified file.
-        g_RoutingTable = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
-
-        Simulator *s = SimulatorBuilder(SimulatorType::ROOTSIM, mode)
+        SimulatorType  type = nativeArg.getValue() ? SimulatorType::NATIVE
+                                                   : SimulatorType::ROOTSIM;
+
+        // The conservative mode is only implemented by the native engine.
+        if (conservativeArg.getValue()) {
+            mode = SimulationMode::CONSERVATIVE;
+            type = SimulatorType::NATIVE;
+        }
+
+        // Compute the routes from the services' identifiers, or create and
+        // read the routing table from the specified file.
+        if (implicitArg.getValue()) {
+            const uint32_t extents[1] = {machineAmount + 1U};
+            g_RouteProvider = new TorusRouteProvider(1U, extents, false);
+        }
+        else {
+            createLinearTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
+            g_RouteProvider = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        }
+
+        Simulator *s = SimulatorBuilder(type, mode)
                            .setThreads(coresArg.getValue())
                            .setGvtPeriod(gvtPeriodArg.getValue())
                            .setCoreBinding(coreBindingArg.getValue())
@@ -2,6 +2,7 @@
 #include <core/core.hpp>
 #include <fstream>
 #include <model/builder.hpp>
+#include <routing/implicit.hpp>
 #include <routing/table.hpp>
 #include <simulator/simulator.hpp>
 #include <string>
@@ -11,7 +12,6 @@
 
 #define DEFAULT_ROUTE_FILENAME "topology_ring/routes.route"
 
-extern RoutingTable *g_RoutingTable;
 
 using namespace ispd::sim;
 
@@ -25,10 +25,16 @@ using namespace ispd::sim;
 /// is used to maintain consistency with simulation cases that typically involve
 /// reading a file for the routing table.
 ///
+/// If the amount of services in the ring is even, the machine opposite to the
+/// master is reached by two equal-cost routes. If `ecmp` is set, then both
+/// routes are written as the alternatives of that machine's route.
+///
 /// \param filename The name of the routing file to be created.
 /// \param machineAmount The total number of machines in the ring topology.
+/// \param ecmp Whether both routes to the opposite machine are written.
 static inline void createRingTopologyRouting(const std::string &filename,
-                                             const uint32_t     machineAmount)
+                                             const uint32_t     machineAmount,
+                                             const bool         ecmp = false)
 {
     std::ofstream routeFile(filename);
 
@@ -56,6 +62,16 @@ static inline void createRingTopologyRouting(const std::string &filename,
         for (uint32_t linkId = 1; linkId < machineId; linkId += 2)
             route += std::to_string(linkId) + " ";
 
+        // The opposite machine is also reached through the other direction,
+        // which is written as an alternative of the route.
+        if (ecmp && machineAmount % 2 && machineId == machineAmount + 1) {
+            route += "| ";
+
+            for (uint32_t linkId  = machineHigherId + 1; linkId > machineId;
+                 linkId          -= 2)
+                route += std::to_string(linkId) + " ";
+        }
+
         // Write the route between the master (0) and the current machine.
         routeFile << "0 " << machineId << ' ' << route << '\n';
     }
@@ -146,6 +162,43 @@ int main(int argc, char **argv)
             "b", "core-binding", "Enable the thread-to-core binding.", false);
         cmd.add(coreBindingArg);
 
+        // Argument to specify if the simulation should be progressed by the
+        // native engine instead of the ROOT-Sim.
+        TCLAP::SwitchArg nativeArg(
+            "n",
+            "native",
+            "Progress the simulation using the native engine.",
+            false);
+        cmd.add(nativeArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // conservative mode.
+        TCLAP::SwitchArg conservativeArg(
+            "C",
+            "conservative",
+            "Progress the simulation in the conservative mode.",
+            false);
+        cmd.add(conservativeArg);
+
+        // Argument to specify if the routes should be computed in a closed
+        // form from the services' identifiers instead of read from the
+        // routing file.
+        TCLAP::SwitchArg implicitArg(
+            "r",
+            "implicit-routes",
+            "Compute the routes from the services' identifiers.",
+            false);
+        cmd.add(implicitArg);
+
+        // Argument to specify if both equal-cost routes to the machine
+        // opposite to the master should be written in the routing file.
+        TCLAP::SwitchArg ecmpArg(
+            "e",
+            "ecmp",
+            "Write both equal-cost routes to the opposite machine.",
+            false);
+        cmd.add(ecmpArg);
+
         // Parse the command-line arguments.
         cmd.parse(argc, argv);
 
@@ -153,6 +206,14 @@ int main(int argc, char **argv)
         uint32_t       machineAmount = machineArg.getValue();
         SimulationMode mode = serialArg.getValue() ? SimulationMode::SEQUENTIAL
                                                    : SimulationMode::OPTIMISTIC;
+        SimulatorType  type = nativeArg.getValue() ? SimulatorType::NATIVE
+                                                   : SimulatorType::ROOTSIM;
+
+        // The conservative mode is only implemented by the native engine.
+        if (conservativeArg.getValue()) {
+            mode = SimulationMode::CONSERVATIVE;
+            type = SimulatorType::NATIVE;
+        }
 
         // A ring topology can not be created with only one master and machine
         // in the topology. Therefore, it must have more than only one machine
@@ -160,12 +221,19 @@ int main(int argc, char **argv)
         if (machineAmount <= 1)
             die("Machine amount should be greater than 1.\n");
 
-        createRingTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
-
-        // Read the routing table from the specified file.
-        g_RoutingTable = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        // Compute the routes from the services' identifiers, or create and
+        // read the routing table from the specified file.
+        if (implicitArg.getValue()) {
+            const uint32_t extents[1] = {machineAmount + 1U};
+            g_RouteProvider = new TorusRouteProvider(1U, extents);
+        }
+        else {
+            createRingTopologyRouting(
+                DEFAULT_ROUTE_FILENAME, machineAmount, ecmpArg.getValue());
+            g_RouteProvider = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        }
 
-        Simulator *s = SimulatorBuilder(SimulatorType::ROOTSIM, mode)
+        Simulator *s = SimulatorBuilder(type, mode)
                            .setThreads(coresArg.getValue())
                            .setGvtPeriod(gvtPeriodArg.getValue())
                            .setCoreBinding(coreBindingArg.getValue())
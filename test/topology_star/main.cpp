@@ -1,7 +1,9 @@
 #include "allocator/rootsim_allocator.hpp"
+#include <algorithm>
 #include <core/core.hpp>
 #include <fstream>
 #include <model/builder.hpp>
+#include <routing/implicit.hpp>
 #include <routing/table.hpp>
 #include <simulator/simulator.hpp>
 #include <string>
@@ -11,7 +13,6 @@
 
 #define DEFAULT_ROUTE_FILENAME "topology_star/routes.route"
 
-extern RoutingTable *g_RoutingTable;
 
 using namespace ispd::sim;
 
@@ -119,20 +120,104 @@ int main(int argc, char **argv)
             "b", "core-binding", "Enable the thread-to-core binding.", false);
         cmd.add(coreBindingArg);
 
+        // Argument to specify if the simulation should be progressed by the
+        // native engine instead of the ROOT-Sim.
+        TCLAP::SwitchArg nativeArg(
+            "n",
+            "native",
+            "Progress the simulation using the native engine.",
+            false);
+        cmd.add(nativeArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // conservative mode.
+        TCLAP::SwitchArg conservativeArg(
+            "C",
+            "conservative",
+            "Progress the simulation in the conservative mode.",
+            false);
+        cmd.add(conservativeArg);
+
+        // Argument to specify if the routes should be computed in a closed
+        // form from the services' identifiers instead of read from the
+        // routing file.
+        TCLAP::SwitchArg implicitArg(
+            "r",
+            "implicit-routes",
+            "Compute the routes from the services' identifiers.",
+            false);
+        cmd.add(implicitArg);
+
+        // Argument to specify if the machines' cores should be shared among
+        // the tasks instead of processing them in the arrival order.
+        TCLAP::SwitchArg sharingArg(
+            "P",
+            "processor-sharing",
+            "Share the machines' cores among the tasks being processed.",
+            false);
+        cmd.add(sharingArg);
+
+        // Argument to specify if the links should communicate the packets in
+        // both directions at the same time instead of one at a time.
+        TCLAP::SwitchArg fullDuplexArg(
+            "D",
+            "full-duplex",
+            "Communicate the packets in both directions of the links at once.",
+            false);
+        cmd.add(fullDuplexArg);
+
+        // Argument to specify if the tasks should be injected in the master
+        // as events instead of being taken from its workload.
+        TCLAP::SwitchArg injectedArg(
+            "I",
+            "injected",
+            "Inject the tasks in the master as events arriving over time.",
+            false);
+        cmd.add(injectedArg);
+
+        // Argument to specify the amount of injected tasks that arrive at the
+        // master at the same time.
+        TCLAP::ValueArg<uint32_t> burstArg(
+            "B",
+            "burst",
+            "Specify the amount of injected tasks that arrive at once.",
+            false,
+            1,
+            "uint32_t");
+        cmd.add(burstArg);
+
         // Parse the command-line arguments.
         cmd.parse(argc, argv);
 
         uint32_t       taskAmount    = taskArg.getValue();
         uint32_t       machineAmount = machineArg.getValue();
+        const bool     sharing       = sharingArg.getValue();
+        const bool     injected      = injectedArg.getValue();
+        const uint32_t burst         = std::max(1U, burstArg.getValue());
         SimulationMode mode = serialArg.getValue() ? SimulationMode::SEQUENTIAL
                                                    : SimulationMode::OPTIMISTIC;
+        SimulatorType  type = nativeArg.getValue() ? SimulatorType::NATIVE
+                                                   : SimulatorType::ROOTSIM;
 
-        createStarTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
+        // The conservative mode is only implemented by the native engine.
+        if (conservativeArg.getValue()) {
+            mode = SimulationMode::CONSERVATIVE;
+            type = SimulatorType::NATIVE;
+        }
 
-        // Read the routing table from the specified file.
-        g_RoutingTable = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        const LinkDuplex duplex =
+            fullDuplexArg.getValue() ? LinkDuplex::FULL : LinkDuplex::HALF;
 
-        Simulator *s = SimulatorBuilder(SimulatorType::ROOTSIM, mode)
+        // Compute the routes from the services' identifiers, or create and
+        // read the routing table from the specified file.
+        if (implicitArg.getValue())
+            g_RouteProvider = new StarRouteProvider(machineAmount + 1U);
+        else {
+            createStarTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
+            g_RouteProvider = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        }
+
+        Simulator *s = SimulatorBuilder(type, mode)
                            .setThreads(coresArg.getValue())
                            .setGvtPeriod(gvtPeriodArg.getValue())
                            .setCoreBinding(coreBindingArg.getValue())
@@ -148,10 +233,29 @@ int main(int argc, char **argv)
         builder.registerMaster(
             0ULL,
             ispd::model::MasterScheduler::ROUND_ROBIN,
-            [taskAmount, machineHigherId](Master *m) {
-                m->m_Workload =
-                    ROOTSimAllocator<>::construct<UniformRandomWorkload>(
-                        taskAmount, 10.0, 15.0, 20.0, 50.0);
+            [taskAmount, machineHigherId, injected, burst](Master *m) {
+                // The injected tasks are constant-sized and arrive in bursts
+                // far apart, such that, the model is empty between them and
+                // the master is only kept from being quiescent by the tasks
+                // that are yet to arrive. Further, the tasks of a burst that
+                // are scheduled to the same machine share its cores if the
+                // machines are processor-sharing.
+                if (injected) {
+                    for (uint32_t i = 0; i < taskAmount; i++) {
+                        Event e(Task(i, m->getId(), 50.0, 35.0));
+                        ispd::schedule_event(m->getId(),
+                                             (i / burst) * 200.0,
+                                             TASK_ARRIVAL,
+                                             &e,
+                                             sizeof(Event));
+                    }
+
+                    m->addPendingArrivals(taskAmount);
+                }
+                else
+                    m->m_Workload =
+                        ROOTSimAllocator<>::construct<UniformRandomWorkload>(
+                            taskAmount, 10.0, 15.0, 20.0, 50.0);
 
                 // Add the slaves.
                 for (uint32_t machineId  = 2UL; machineId <= machineHigherId;
@@ -168,13 +272,24 @@ int main(int argc, char **argv)
         for (uint32_t machineId  = 2UL; machineId <= machineHigherId;
              machineId          += 2UL) {
             const uint32_t linkId = machineId - 1UL;
-            builder.registerMachine(machineId, 2.0, 0.0, 2);
-            builder.registerLink(linkId, 0ULL, machineId, 5.0, 0.0, 1.0);
+
+            if (sharing)
+                builder.registerSharingMachine(machineId, 2.0, 0.0, 2);
+            else
+                builder.registerMachine(machineId, 2.0, 0.0, 2);
+
+            builder.registerLink(
+                linkId, 0ULL, machineId, 5.0, 0.0, 1.0, duplex);
         }
 
         ispd::test::registerMasterServiceFinalizer(s, 0ULL);
         ispd::test::registerMachineServiceFinalizer(s, 2ULL);
 
+        // Print the first link's communication in each direction, which is
+        // only inspected when the links are full-duplex.
+        if (fullDuplexArg.getValue())
+            ispd::test::registerLinkServiceFinalizer(s, 1ULL);
+
         s->simulate();
     }
     catch (const TCLAP::ArgException &e) {
@@ -1,7 +1,10 @@
 #include "allocator/rootsim_allocator.hpp"
 #include <core/core.hpp>
 #include <fstream>
+#include <limits>
 #include <model/builder.hpp>
+#include <routing/forwarding.hpp>
+#include <routing/implicit.hpp>
 #include <routing/table.hpp>
 #include <simulator/simulator.hpp>
 #include <string>
@@ -11,7 +14,6 @@
 
 #define DEFAULT_ROUTE_FILENAME "topology_star_switched/routes.route"
 
-extern RoutingTable *g_RoutingTable;
 
 using namespace ispd::sim;
 
@@ -136,20 +138,83 @@ int main(int argc, char **argv)
             "b", "core-binding", "Enable the thread-to-core binding.", false);
         cmd.add(coreBindingArg);
 
+        // Argument to specify if the simulation should be progressed by the
+        // native engine instead of the ROOT-Sim.
+        TCLAP::SwitchArg nativeArg(
+            "n",
+            "native",
+            "Progress the simulation using the native engine.",
+            false);
+        cmd.add(nativeArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // conservative mode.
+        TCLAP::SwitchArg conservativeArg(
+            "C",
+            "conservative",
+            "Progress the simulation in the conservative mode.",
+            false);
+        cmd.add(conservativeArg);
+
+        // Argument to specify if the routes should be computed in a closed
+        // form from the services' identifiers instead of read from the
+        // routing file.
+        TCLAP::SwitchArg implicitArg(
+            "r",
+            "implicit-routes",
+            "Compute the routes from the services' identifiers.",
+            false);
+        cmd.add(implicitArg);
+
+        // Argument to specify if the packets should be forwarded through the
+        // services' forwarding tables instead of the routes.
+        TCLAP::SwitchArg forwardingArg(
+            "f",
+            "forwarding-tables",
+            "Forward the packets through the services' forwarding tables.",
+            false);
+        cmd.add(forwardingArg);
+
+        // Argument to specify if the machines should be modeled by a single
+        // cluster instead of a machine and a link each.
+        TCLAP::SwitchArg clusterArg(
+            "K",
+            "cluster",
+            "Model the machines and their links as a single cluster.",
+            false);
+        cmd.add(clusterArg);
+
         // Parse the command-line arguments.
         cmd.parse(argc, argv);
 
         uint32_t       taskAmount    = taskArg.getValue();
         uint32_t       machineAmount = machineArg.getValue();
+        const bool     cluster       = clusterArg.getValue();
         SimulationMode mode = serialArg.getValue() ? SimulationMode::SEQUENTIAL
                                                    : SimulationMode::OPTIMISTIC;
+        SimulatorType  type = nativeArg.getValue() ? SimulatorType::NATIVE
+                                                   : SimulatorType::ROOTSIM;
+
+        // The conservative mode is only implemented by the native engine.
+        if (conservativeArg.getValue()) {
+            mode = SimulationMode::CONSERVATIVE;
+            type = SimulatorType::NATIVE;
+        }
 
-        createStarTopologyRouting(DEFAULT_ROUTE_FILENAME, machineAmount);
+        // The cluster is connected to the switch as a single machine.
+        const uint32_t routedMachines = cluster ? 1U : machineAmount;
 
-        // Read the routing table from the specified file.
-        g_RoutingTable = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        // Compute the routes from the services' identifiers, or create and
+        // read the routing table from the specified file, unless the packets
+        // are forwarded through the forwarding tables.
+        if (implicitArg.getValue())
+            g_RouteProvider = new StarRouteProvider(routedMachines + 2U, true);
+        else if (!forwardingArg.getValue()) {
+            createStarTopologyRouting(DEFAULT_ROUTE_FILENAME, routedMachines);
+            g_RouteProvider = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        }
 
-        Simulator *s = SimulatorBuilder(SimulatorType::ROOTSIM, mode)
+        Simulator *s = SimulatorBuilder(type, mode)
                            .setThreads(coresArg.getValue())
                            .setGvtPeriod(gvtPeriodArg.getValue())
                            .setCoreBinding(coreBindingArg.getValue())
@@ -165,15 +230,19 @@ int main(int argc, char **argv)
         builder.registerMaster(
             0ULL,
             ispd::model::MasterScheduler::ROUND_ROBIN,
-            [taskAmount, machineHigherId](Master *m) {
+            [taskAmount, machineAmount, machineHigherId, cluster](Master *m) {
                 m->m_Workload =
                     ROOTSimAllocator<>::construct<UniformRandomWorkload>(
                         taskAmount, 10.0, 15.0, 20.0, 50.0);
 
-                // Add the slaves.
-                for (sid_t machineId  = 4ULL; machineId <= machineHigherId;
-                     machineId       += 2ULL)
-                    m->addSlave(machineId);
+                // Add the slaves, which are the cluster's machines in the
+                // same order as the machines registered one by one.
+                if (cluster)
+                    m->addClusterSlaves(4ULL, machineAmount);
+                else
+                    for (sid_t machineId  = 4ULL; machineId <= machineHigherId;
+                         machineId       += 2ULL)
+                        m->addSlave(machineId);
 
                 /// It sends an event to the master to indicate that its
                 /// scheduling algorithm should be initialized.
@@ -181,20 +250,47 @@ int main(int argc, char **argv)
                     m->getId(), 0.0, TASK_SCHEDULER_INIT, nullptr, 0);
             });
 
-        // Register the machines and links in the star topology model.
-        for (sid_t machineId  = 4ULL; machineId <= machineHigherId;
-             machineId       += 2ULL) {
-            const sid_t linkId = machineId - 1UL;
-            builder.registerMachine(machineId, 2.0, 0.0, 2);
-            builder.registerLink(linkId, 2ULL, machineId, 5.0, 0.0, 1.0);
+        // Register the machines and links in the star topology model. The
+        // cluster's machines have the same parameters, and the cluster is
+        // connected to the switch by a link that takes no time, such that,
+        // both models are equivalent.
+        if (cluster) {
+            builder.registerCluster(
+                4ULL, machineAmount, 2.0, 0.0, 2, 5.0, 0.0, 1.0);
+            builder.registerLink(3ULL,
+                                 2ULL,
+                                 4ULL,
+                                 std::numeric_limits<double>::infinity(),
+                                 0.0,
+                                 0.0);
         }
+        else
+            for (sid_t machineId  = 4ULL; machineId <= machineHigherId;
+                 machineId       += 2ULL) {
+                const sid_t linkId = machineId - 1UL;
+                builder.registerMachine(machineId, 2.0, 0.0, 2);
+                builder.registerLink(linkId, 2ULL, machineId, 5.0, 0.0, 1.0);
+            }
 
         builder.registerSwitch(2ULL, 100.0, 0.0, 0.0);
         builder.registerLink(1ULL, 0ULL, 2ULL, 5.0, 0.0, 1.0);
 
+        // Build the forwarding tables from the links registered above.
+        if (forwardingArg.getValue())
+            g_ForwardingTable = new ForwardingTable(s->getServiceTable());
+
         ispd::test::registerMasterServiceFinalizer(s, 0ULL);
         ispd::test::registerSwitchServiceFinalizer(s, 2ULL);
-        ispd::test::registerMachineServiceFinalizer(s, 4ULL);
+
+        // Print every machine, such that, the split of the tasks among the
+        // cluster's machines is compared with the machines registered one
+        // by one.
+        if (cluster)
+            ispd::test::registerClusterServiceFinalizer(s, 4ULL);
+        else
+            for (sid_t machineId  = 4ULL; machineId <= machineHigherId;
+                 machineId       += 2ULL)
+                ispd::test::registerMachineServiceFinalizer(s, machineId);
 
         s->simulate();
     }
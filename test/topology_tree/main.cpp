@@ -1,6 +1,9 @@
 #include <core/core.hpp>
 #include <fstream>
 #include <model/builder.hpp>
+#include <routing/forwarding.hpp>
+#include <routing/partition.hpp>
+#include <routing/shortest_path.hpp>
 #include <routing/table.hpp>
 #include <simulator/simulator.hpp>
 #include <string>
@@ -10,7 +13,6 @@
 
 #define DEFAULT_ROUTE_FILENAME "topology_tree/routes.route"
 
-extern RoutingTable *g_RoutingTable;
 
 using namespace ispd::sim;
 
@@ -86,6 +88,51 @@ int main(int argc, char **argv)
             "b", "core-binding", "Enable the thread-to-core binding.", false);
         cmd.add(coreBindingArg);
 
+        // Argument to specify if the simulation should be progressed by the
+        // native engine instead of the ROOT-Sim.
+        TCLAP::SwitchArg nativeArg(
+            "n",
+            "native",
+            "Progress the simulation using the native engine.",
+            false);
+        cmd.add(nativeArg);
+
+        // Argument to specify if the simulation should be executed in the
+        // conservative mode.
+        TCLAP::SwitchArg conservativeArg(
+            "C",
+            "conservative",
+            "Progress the simulation in the conservative mode.",
+            false);
+        cmd.add(conservativeArg);
+
+        // Argument to specify if the routes should be computed on demand
+        // from the registered links instead of read from the routing file.
+        TCLAP::SwitchArg shortestPathArg(
+            "p",
+            "shortest-path",
+            "Compute the routes on demand from the registered links.",
+            false);
+        cmd.add(shortestPathArg);
+
+        // Argument to specify if the packets should be forwarded through the
+        // services' forwarding tables instead of the routes.
+        TCLAP::SwitchArg forwardingArg(
+            "f",
+            "forwarding-tables",
+            "Forward the packets through the services' forwarding tables.",
+            false);
+        cmd.add(forwardingArg);
+
+        // Argument to specify if only the routes looked up by the services of
+        // this rank should be read from the routing file.
+        TCLAP::SwitchArg shardedArg(
+            "S",
+            "sharded",
+            "Read only the routes looked up by the services of this rank.",
+            false);
+        cmd.add(shardedArg);
+
         // Parse the command-line arguments.
         cmd.parse(argc, argv);
 
@@ -93,11 +140,25 @@ int main(int argc, char **argv)
         uint32_t       machineAmount = machineArg.getValue();
         SimulationMode mode = serialArg.getValue() ? SimulationMode::SEQUENTIAL
                                                    : SimulationMode::OPTIMISTIC;
+        SimulatorType  type = nativeArg.getValue() ? SimulatorType::NATIVE
+                                                   : SimulatorType::ROOTSIM;
+
+        // The conservative mode is only implemented by the native engine.
+        if (conservativeArg.getValue()) {
+            mode = SimulationMode::CONSERVATIVE;
+            type = SimulatorType::NATIVE;
+        }
+
+        const bool readRoutes =
+            !shortestPathArg.getValue() && !forwardingArg.getValue();
 
-        // Read the routing table from the specified file.
-        g_RoutingTable = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
+        // Read the routing table from the specified file, unless the routes
+        // are computed on demand, the packets are forwarded through the
+        // forwarding tables or the routing table is sharded.
+        if (readRoutes && !shardedArg.getValue())
+            g_RouteProvider = RoutingTableReader().read(DEFAULT_ROUTE_FILENAME);
 
-        Simulator *s = SimulatorBuilder(SimulatorType::ROOTSIM, mode)
+        Simulator *s = SimulatorBuilder(type, mode)
                            .setThreads(coresArg.getValue())
                            .setGvtPeriod(gvtPeriodArg.getValue())
                            .setCoreBinding(coreBindingArg.getValue())
@@ -169,6 +230,26 @@ int main(int argc, char **argv)
         builder.registerLink(13ULL, 4ULL, 14ULL, 5.0, 0.0, 1.0);
         builder.registerLink(15ULL, 14ULL, 16ULL, 5.0, 0.0, 1.0);
 
+        // Compute the routes on demand from the links registered above.
+        if (shortestPathArg.getValue())
+            g_RouteProvider =
+                new ShortestPathRouteProvider(s->getServiceTable());
+
+        // Build the forwarding tables from the links registered above.
+        if (forwardingArg.getValue())
+            g_ForwardingTable = new ForwardingTable(s->getServiceTable());
+
+        // Read this rank's shard of the routing table, which depends on the
+        // links registered above.
+        if (readRoutes && shardedArg.getValue()) {
+            const ServiceTable &services  = s->getServiceTable();
+            const PartitionMap  partition =
+                PartitionMap::fromEnvironment(services.size());
+
+            g_RouteProvider = RoutingTableReader().read(
+                DEFAULT_ROUTE_FILENAME, partition.makeRouteFilter(services));
+        }
+
         ispd::test::registerMasterServiceFinalizer(s, 0ULL);
         ispd::test::registerMasterServiceFinalizer(s, 2ULL);
         ispd::test::registerMachineServiceFinalizer(s, 6ULL);
@@ -0,0 +1,32 @@
+#include <cstdio>
+#include <routing/table.hpp>
+
+/**
+ * @brief Converts a routing file in the text `.route` format (or a binary
+ *        routing file) to the binary routing file format.
+ *
+ *        Usage: route_converter <input> <output>
+ */
+int main(int argc, char **argv)
+{
+    --argc, ++argv;
+
+    if (argc != 2) {
+        std::fprintf(stderr, "Usage: route_converter <input> <output>\n");
+        return 1;
+    }
+
+    RoutingTable *rt = RoutingTableReader().read(argv[0]);
+    rt->write(argv[1]);
+
+    std::printf("Converted %zu routes (%zu alternatives, %zu path elements) "
+                "from '%s' to '%s'.\n",
+                rt->getRoutesSize(),
+                rt->getAlternativesSize(),
+                rt->getPathsSize(),
+                argv[0],
+                argv[1]);
+
+    delete rt;
+    return 0;
+}